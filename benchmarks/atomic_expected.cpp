@@ -0,0 +1,70 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -pthread -I include -I benchmarks benchmarks/atomic_expected.cpp && ./a.out
+ */
+
+#include <expected/atomic_expected.hpp>
+#include <benchmark.hpp>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main()
+{
+	constexpr std::size_t count = 100000;
+
+	bench::report("atomic_expected set + wait, same thread", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+		{
+			nl::atomic_expected<int, std::string> slot;
+			slot.set_value(static_cast<int>(i));
+			bench::do_not_optimize(*slot.wait());
+		}
+	}));
+
+	bench::report("promise set + future get, same thread", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+		{
+			std::promise<nl::expected<int, std::string>> promise;
+			std::future<nl::expected<int, std::string>>  future = promise.get_future();
+			promise.set_value(static_cast<int>(i));
+			bench::do_not_optimize(*future.get());
+		}
+	}));
+
+	bench::report("atomic_expected handoff, two threads", bench::measure(count, [&] {
+		std::unique_ptr<nl::atomic_expected<int, std::string>[]> slots(new nl::atomic_expected<int, std::string>[count]);
+		std::thread producer([&] {
+			for (std::size_t i = 0; i < count; i++)
+				slots[i].set_value(static_cast<int>(i));
+		});
+		long sum = 0;
+		for (std::size_t i = 0; i < count; i++)
+			sum += *slots[i].wait();
+		producer.join();
+		bench::do_not_optimize(sum);
+	}));
+
+	bench::report("promise/future handoff, two threads", bench::measure(count, [&] {
+		std::vector<std::promise<nl::expected<int, std::string>>> promises(count);
+		std::vector<std::future<nl::expected<int, std::string>>>  futures;
+		futures.reserve(count);
+		for (auto& promise : promises)
+			futures.push_back(promise.get_future());
+		std::thread producer([&] {
+			for (std::size_t i = 0; i < count; i++)
+				promises[i].set_value(static_cast<int>(i));
+		});
+		long sum = 0;
+		for (auto& future : futures)
+			sum += *future.get();
+		producer.join();
+		bench::do_not_optimize(sum);
+	}));
+	return 0;
+}
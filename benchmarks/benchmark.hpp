@@ -0,0 +1,41 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace bench {
+	template<class T>
+	inline void do_not_optimize(const T& value)
+	{
+		asm volatile("" : : "r,m"(value) : "memory");
+	}
+
+	// best of several rounds, in nanoseconds per operation
+	template<class F>
+	double measure(std::size_t operations, F&& f, int rounds = 5)
+	{
+		double best = 0;
+		for (int round = 0; round < rounds; round++)
+		{
+			auto start = std::chrono::steady_clock::now();
+			f();
+			std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+			double per_operation				 = elapsed.count() / static_cast<double>(operations);
+			if (round == 0 || per_operation < best)
+				best = per_operation;
+		}
+		return best;
+	}
+
+	inline void report(const char* name, double nanoseconds)
+	{
+		std::printf("%-40s %10.2f ns/op\n", name, nanoseconds);
+	}
+}
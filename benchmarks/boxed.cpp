@@ -0,0 +1,65 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include -I benchmarks benchmarks/boxed.cpp && ./a.out
+ */
+
+#include <expected/boxed.hpp>
+#include <benchmark.hpp>
+#include <random>
+#include <vector>
+
+namespace {
+	struct large_error {
+			int  code;
+			char detail[60];
+
+			large_error() : code(0), detail{}
+			{
+			}
+
+			explicit large_error(int c) : code(c), detail{}
+			{
+			}
+	};
+
+	template<class E>
+	__attribute__((noinline)) long scan(const std::vector<nl::expected<int, E>>& results)
+	{
+		long sum = 0;
+		for (const auto& result : results)
+			sum += result.has_value() ? *result : 0;
+		return sum;
+	}
+
+	template<class E>
+	void run(const char* name, std::size_t count)
+	{
+		std::mt19937		    engine(9);
+		std::bernoulli_distribution failure(0.01);
+
+		std::vector<nl::expected<int, E>> results;
+		results.reserve(count);
+		for (std::size_t i = 0; i < count; i++)
+		{
+			if (failure(engine))
+				results.emplace_back(E(large_error(1)));
+			else
+				results.emplace_back(static_cast<int>(i));
+		}
+
+		std::printf("%s: sizeof(expected) = %zu\n", name, sizeof(nl::expected<int, E>));
+		bench::report("  scan of the values", bench::measure(count, [&] { bench::do_not_optimize(scan(results)); }));
+	}
+}
+
+int main()
+{
+	constexpr std::size_t count = 10000000;
+	run<large_error>("inline 64-byte error", count);
+	run<nl::boxed<large_error>>("boxed 64-byte error", count);
+	run<nl::boxed_if_large<large_error>>("boxed_if_large<64-byte error>", count);
+	return 0;
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include -I benchmarks benchmarks/collect.cpp && ./a.out
+ */
+
+#include <expected/algorithm.hpp>
+#include <benchmark.hpp>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+	using result = nl::expected<long, std::errc>;
+
+	__attribute__((noinline)) nl::expected<std::vector<long>, std::errc> manual(const std::vector<result>& results)
+	{
+		std::vector<long> values;
+		for (const auto& r : results)
+		{
+			if (not r.has_value())
+				return nl::expected<std::vector<long>, std::errc>(r.error());
+			values.push_back(*r);
+		}
+		return nl::expected<std::vector<long>, std::errc>(std::move(values));
+	}
+
+	std::vector<result> make_results(std::size_t count, std::size_t failure)
+	{
+		std::vector<result> results;
+		results.reserve(count);
+		for (std::size_t i = 0; i < count; i++)
+		{
+			if (i == failure)
+				results.emplace_back(std::errc::io_error);
+			else
+				results.emplace_back(static_cast<long>(i));
+		}
+		return results;
+	}
+}
+
+int main()
+{
+	constexpr std::size_t count = 1 << 20;
+	const std::size_t     failures[] = {count, 16, count - 16};
+	const char*	      names[]	 = {"no failure", "early failure", "late failure"};
+
+	for (std::size_t i = 0; i < 3; i++)
+	{
+		std::vector<result> results  = make_results(count, failures[i]);
+		std::size_t	    visited = failures[i] < count ? failures[i] + 1 : count;
+		std::printf("%s, per visited element\n", names[i]);
+		bench::report("  push_back loop", bench::measure(visited, [&] { bench::do_not_optimize(manual(results).has_value()); }));
+		bench::report("  nl::collect<std::vector>", bench::measure(visited, [&] {
+			bench::do_not_optimize(nl::collect<std::vector<long>>(results).has_value());
+		}));
+	}
+	return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include -I benchmarks benchmarks/context_error.cpp && ./a.out
+ */
+
+#include <expected/context_error.hpp>
+#include <benchmark.hpp>
+#include <string>
+#include <system_error>
+
+namespace {
+	using bare	= nl::expected<int, std::errc>;
+	using annotated = nl::expected<int, nl::context_error<std::errc>>;
+
+	template<int Depth>
+	__attribute__((noinline)) bare plain(int i)
+	{
+		if constexpr (Depth == 0)
+		{
+			if (i >= 0)
+				return std::errc::io_error;
+			return 0;
+		}
+		else
+		{
+			bare result = plain<Depth - 1>(i);
+			asm volatile("" ::: "memory");
+			return result;
+		}
+	}
+
+	template<int Depth>
+	__attribute__((noinline)) annotated layered(int i)
+	{
+		if constexpr (Depth == 0)
+		{
+			if (i >= 0)
+				return nl::context_error<std::errc>(std::errc::io_error);
+			return 0;
+		}
+		else
+		{
+			return layered<Depth - 1>(i).context("in layer {}", Depth);
+		}
+	}
+
+	template<int Depth>
+	void run(std::size_t count)
+	{
+		std::string suffix = ", " + std::to_string(Depth) + (Depth == 1 ? " layer" : " layers");
+		bench::report(("bare error return" + suffix).c_str(), bench::measure(count, [&] {
+			for (std::size_t i = 0; i < count; i++)
+				bench::do_not_optimize(plain<Depth>(static_cast<int>(i)).has_value());
+		}));
+		bench::report(("context() on every layer" + suffix).c_str(), bench::measure(count, [&] {
+			for (std::size_t i = 0; i < count; i++)
+				bench::do_not_optimize(layered<Depth>(static_cast<int>(i)).has_value());
+		}));
+
+		annotated failed = layered<Depth>(1);
+		bench::report(("walk frames" + suffix).c_str(), bench::measure(count, [&] {
+			for (std::size_t i = 0; i < count; i++)
+			{
+				std::int64_t sum = 0;
+				for (std::size_t frame = 0; frame < failed.error().depth(); frame++)
+					sum += failed.error().frame(frame).argument;
+				bench::do_not_optimize(sum);
+			}
+		}));
+		bench::report(("render message()" + suffix).c_str(), bench::measure(count / 10, [&] {
+			for (std::size_t i = 0; i < count / 10; i++)
+				bench::do_not_optimize(failed.error().message().size());
+		}));
+	}
+}
+
+int main()
+{
+	constexpr std::size_t count = 1000000;
+	run<1>(count);
+	run<4>(count);
+	run<16>(count);
+	return 0;
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include -I benchmarks benchmarks/erased_error.cpp && ./a.out
+ */
+
+#include <expected/erased_error.hpp>
+#include <benchmark.hpp>
+#include <any>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace {
+	struct parse_error {
+			int line;
+			int column;
+	};
+}
+
+int main()
+{
+	constexpr std::size_t count = 1000000;
+
+	bench::report("nl::erased_error construct/move/destroy", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+		{
+			nl::erased_error error(parse_error{static_cast<int>(i), 1});
+			nl::erased_error moved(std::move(error));
+			bench::do_not_optimize(moved);
+		}
+	}));
+	bench::report("std::any construct/move/destroy", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+		{
+			std::any error(parse_error{static_cast<int>(i), 1});
+			std::any moved(std::move(error));
+			bench::do_not_optimize(moved);
+		}
+	}));
+	bench::report("std::exception_ptr construct/move/destroy", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+		{
+			std::exception_ptr error = std::make_exception_ptr(parse_error{static_cast<int>(i), 1});
+			std::exception_ptr moved(std::move(error));
+			bench::do_not_optimize(moved);
+		}
+	}));
+
+	bench::report("nl::erased_error, std::runtime_error payload", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+		{
+			nl::erased_error error(std::runtime_error("a message long enough to need the heap"));
+			nl::erased_error moved(std::move(error));
+			bench::do_not_optimize(moved);
+		}
+	}));
+	bench::report("std::any, std::runtime_error payload", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+		{
+			std::any error(std::runtime_error("a message long enough to need the heap"));
+			std::any moved(std::move(error));
+			bench::do_not_optimize(moved);
+		}
+	}));
+	return 0;
+}
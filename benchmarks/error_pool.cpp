@@ -0,0 +1,85 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -pthread -I include -I benchmarks benchmarks/error_pool.cpp && ./a.out
+ */
+
+#include <expected/boxed.hpp>
+#include <benchmark.hpp>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+	struct payload {
+			int  code;
+			char detail[92];
+
+			explicit payload(int c) : code(c), detail{}
+			{
+			}
+	};
+
+	constexpr std::size_t threads = 8;
+	constexpr std::size_t bursts  = 200;
+	constexpr std::size_t burst   = 1000;
+
+	template<class Box, class Make>
+	void storm(Make make)
+	{
+		std::vector<std::thread> workers;
+		for (std::size_t t = 0; t < threads; t++)
+		{
+			workers.emplace_back(
+			    [&]
+			    {
+				    std::vector<Box> live;
+				    live.reserve(burst);
+				    for (std::size_t b = 0; b < bursts; b++)
+				    {
+					    for (std::size_t i = 0; i < burst; i++)
+						    live.push_back(make(static_cast<int>(i)));
+					    live.clear();
+				    }
+			    });
+		}
+		for (auto& worker : workers)
+			worker.join();
+	}
+
+	template<class Box, class Make>
+	void handoff(Make make)
+	{
+		std::vector<Box> produced;
+		produced.reserve(bursts * burst);
+		std::thread producer(
+		    [&]
+		    {
+			    for (std::size_t i = 0; i < bursts * burst; i++)
+				    produced.push_back(make(static_cast<int>(i)));
+		    });
+		producer.join();
+		std::thread consumer([&] { produced.clear(); });
+		consumer.join();
+	}
+}
+
+int main()
+{
+	constexpr std::size_t operations = threads * bursts * burst;
+
+	auto make_boxed = [](int code) { return nl::boxed<payload>(payload(code)); };
+	auto make_heap	= [](int code) { return std::unique_ptr<payload>(new payload(code)); };
+
+	bench::report("storm, nl::boxed", bench::measure(operations, [&] { storm<nl::boxed<payload>>(make_boxed); }));
+	bench::report("storm, new/delete", bench::measure(operations, [&] { storm<std::unique_ptr<payload>>(make_heap); }));
+	bench::report("remote free, nl::boxed", bench::measure(bursts * burst, [&] { handoff<nl::boxed<payload>>(make_boxed); }));
+	bench::report("remote free, new/delete", bench::measure(bursts * burst, [&] { handoff<std::unique_ptr<payload>>(make_heap); }));
+
+	nl::error_pool_stats stats = nl::error_pool_statistics();
+	std::printf("pool hits %zu, misses %zu, remote frees %zu\n", stats.hits, stats.misses, stats.remote_frees);
+	return 0;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include -I benchmarks benchmarks/error_scan.cpp && ./a.out
+ */
+
+#include <expected/scan.hpp>
+#include <benchmark.hpp>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+	__attribute__((noinline)) std::size_t scalar_count(const nl::expected<int, std::errc>* first, std::size_t count)
+	{
+		std::size_t errors = 0;
+		for (std::size_t i = 0; i < count; i++)
+			errors += not first[i].has_value();
+		return errors;
+	}
+
+	__attribute__((noinline)) std::size_t scalar_first(const nl::expected<int, std::errc>* first, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+		{
+			if (not first[i].has_value())
+				return i;
+		}
+		return count;
+	}
+
+	__attribute__((noinline)) std::size_t scalar_count(const std::uint64_t* bitmap, std::size_t count)
+	{
+		std::size_t errors = 0;
+		for (std::size_t i = 0; i < count; i++)
+			errors += not((bitmap[i / 64] >> (i % 64)) & 1);
+		return errors;
+	}
+}
+
+int main()
+{
+	constexpr std::size_t count	    = 1 << 22;
+	const double	      densities[] = {0.0, 0.0001, 0.01, 0.1, 0.5};
+
+	for (double density : densities)
+	{
+		std::mt19937		    engine(7);
+		std::bernoulli_distribution failure(density);
+
+		std::vector<nl::expected<int, std::errc>> results;
+		std::vector<std::uint64_t>		  bitmap((count + 63) / 64, 0);
+		results.reserve(count);
+		for (std::size_t i = 0; i < count; i++)
+		{
+			if (failure(engine))
+			{
+				results.emplace_back(std::errc::io_error);
+			}
+			else
+			{
+				results.emplace_back(static_cast<int>(i));
+				bitmap[i / 64] |= std::uint64_t(1) << (i % 64);
+			}
+		}
+
+		std::printf("error density %g\n", density);
+		bench::report("  scalar count, array", bench::measure(count, [&] { bench::do_not_optimize(scalar_count(results.data(), count)); }));
+		bench::report("  nl::count_errors, array", bench::measure(count, [&] { bench::do_not_optimize(nl::count_errors(results.data(), count)); }));
+		bench::report("  scalar first error, array", bench::measure(count, [&] { bench::do_not_optimize(scalar_first(results.data(), count)); }));
+		bench::report("  nl::first_error_index, array",
+		    bench::measure(count, [&] { bench::do_not_optimize(nl::first_error_index(results.data(), count)); }));
+		bench::report("  scalar count, bitmap", bench::measure(count, [&] { bench::do_not_optimize(scalar_count(bitmap.data(), count)); }));
+		bench::report("  nl::count_errors, bitmap", bench::measure(count, [&] { bench::do_not_optimize(nl::count_errors(bitmap.data(), count)); }));
+		bench::report("  nl::error_indices, bitmap", bench::measure(count, [&] { bench::do_not_optimize(nl::error_indices(bitmap.data(), count).size()); }));
+	}
+	return 0;
+}
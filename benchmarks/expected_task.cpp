@@ -0,0 +1,98 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include -I benchmarks benchmarks/expected_task.cpp && ./a.out
+ */
+
+#include <expected/coroutine.hpp>
+#include <benchmark.hpp>
+#include <system_error>
+
+namespace {
+	using result = nl::expected<int, std::errc>;
+	using task   = nl::expected_task<int, std::errc>;
+
+	__attribute__((noinline)) result leaf(int value)
+	{
+		if (value < 0)
+			return std::errc::invalid_argument;
+		return value + 1;
+	}
+
+	result manual_1(int value)
+	{
+		result r = leaf(value);
+		if (not r)
+			return r.error();
+		return *r + 1;
+	}
+
+	result manual_2(int value)
+	{
+		result r = manual_1(value);
+		if (not r)
+			return r.error();
+		return *r + 1;
+	}
+
+	result manual_3(int value)
+	{
+		result r = manual_2(value);
+		if (not r)
+			return r.error();
+		return *r + 1;
+	}
+
+	__attribute__((noinline)) result manual_4(int value)
+	{
+		result r = manual_3(value);
+		if (not r)
+			return r.error();
+		return *r + 1;
+	}
+
+	task coroutine_1(int value)
+	{
+		co_return co_await leaf(value) + 1;
+	}
+
+	task coroutine_2(int value)
+	{
+		co_return co_await coroutine_1(value) + 1;
+	}
+
+	task coroutine_3(int value)
+	{
+		co_return co_await coroutine_2(value) + 1;
+	}
+
+	__attribute__((noinline)) task coroutine_4(int value)
+	{
+		co_return co_await coroutine_3(value) + 1;
+	}
+}
+
+int main()
+{
+	constexpr std::size_t count = 1000000;
+
+	bench::report("manual checks, 5 deep, success", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+			bench::do_not_optimize(manual_4(static_cast<int>(i)).has_value());
+	}));
+	bench::report("expected_task, 5 deep, success", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+			bench::do_not_optimize(coroutine_4(static_cast<int>(i)).get().has_value());
+	}));
+	bench::report("manual checks, 5 deep, failure", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+			bench::do_not_optimize(manual_4(-1).has_value());
+	}));
+	bench::report("expected_task, 5 deep, failure", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+			bench::do_not_optimize(coroutine_4(-1).get().has_value());
+	}));
+	return 0;
+}
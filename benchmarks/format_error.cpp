@@ -0,0 +1,55 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include -I benchmarks benchmarks/format_error.cpp && ./a.out
+ */
+
+#include <expected/format_error.hpp>
+#include <benchmark.hpp>
+#include <cstdio>
+#include <string>
+
+namespace {
+	__attribute__((noinline)) nl::expected<int, std::string> eager(int line, const char* file)
+	{
+		return nl::unexpected("failed to parse line " + std::to_string(line) + " of " + file);
+	}
+
+	__attribute__((noinline)) nl::expected<int, std::string> eager_snprintf(int line, const char* file)
+	{
+		char buffer[128];
+		std::snprintf(buffer, sizeof(buffer), "failed to parse line %d of %s", line, file);
+		return nl::unexpected(std::string(buffer));
+	}
+
+	__attribute__((noinline)) nl::expected<int, nl::format_error<int, const char*>> lazy(int line, const char* file)
+	{
+		return nl::make_format_error("failed to parse line {} of {}", line, file);
+	}
+}
+
+int main()
+{
+	constexpr std::size_t count = 1000000;
+	const char*	      file  = "configuration.toml";
+
+	bench::report("eager std::string concatenation", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+			bench::do_not_optimize(eager(static_cast<int>(i), file).has_value());
+	}));
+	bench::report("eager snprintf", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+			bench::do_not_optimize(eager_snprintf(static_cast<int>(i), file).has_value());
+	}));
+	bench::report("nl::format_error, discarded", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+			bench::do_not_optimize(lazy(static_cast<int>(i), file).has_value());
+	}));
+	bench::report("nl::format_error, rendered", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+			bench::do_not_optimize(lazy(static_cast<int>(i), file).error().message().size());
+	}));
+	return 0;
+}
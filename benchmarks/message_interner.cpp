@@ -0,0 +1,77 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -pthread -I include -I benchmarks benchmarks/message_interner.cpp && ./a.out
+ */
+
+#include <expected/interner.hpp>
+#include <benchmark.hpp>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+	constexpr std::size_t distinct	  = 4096;
+	constexpr std::size_t per_thread = 200000;
+
+	template<class F>
+	void on_threads(std::size_t threads, F f)
+	{
+		std::vector<std::thread> workers;
+		for (std::size_t t = 0; t < threads; t++)
+			workers.emplace_back(f, t);
+		for (auto& worker : workers)
+			worker.join();
+	}
+}
+
+int main()
+{
+	std::vector<std::string> messages;
+	for (std::size_t i = 0; i < distinct; i++)
+		messages.push_back("could not open resource number " + std::to_string(i));
+
+	const std::size_t hardware = std::thread::hardware_concurrency() == 0 ? 1 : std::thread::hardware_concurrency();
+	std::vector<std::size_t> steps;
+	for (std::size_t threads = 1; threads < hardware; threads *= 2)
+		steps.push_back(threads);
+	steps.push_back(hardware);
+	if (hardware < 4)
+		steps.push_back(4);
+
+	for (std::size_t threads : steps)
+	{
+		std::printf("%zu threads\n", threads);
+		std::vector<std::unique_ptr<nl::message_interner>> fresh;
+		for (int round = 0; round < 3; round++)
+			fresh.emplace_back(new nl::message_interner());
+		std::size_t round = 0;
+		bench::report("  racing inserts of new messages", bench::measure(threads * distinct, [&] {
+			nl::message_interner& interner = *fresh[round++];
+			on_threads(threads, [&](std::size_t) {
+				for (const auto& message : messages)
+					bench::do_not_optimize(interner.intern(message));
+			});
+		}, 3));
+
+		nl::message_interner interner;
+		for (const auto& message : messages)
+			interner.intern(message);
+		bench::report("  intern of existing messages", bench::measure(threads * per_thread, [&] {
+			on_threads(threads, [&](std::size_t t) {
+				for (std::size_t i = 0; i < per_thread; i++)
+					bench::do_not_optimize(interner.intern(messages[(i + t) % distinct]));
+			});
+		}, 3));
+		bench::report("  text() lookup by id", bench::measure(threads * per_thread, [&] {
+			on_threads(threads, [&](std::size_t t) {
+				for (std::size_t i = 0; i < per_thread; i++)
+					bench::do_not_optimize(interner.text(static_cast<std::uint32_t>((i + t) % distinct + 1)).size());
+			});
+		}, 3));
+	}
+	return 0;
+}
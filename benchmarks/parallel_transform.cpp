@@ -0,0 +1,69 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -pthread -I include -I benchmarks benchmarks/parallel_transform.cpp && ./a.out
+ */
+
+#include <expected/thread_pool.hpp>
+#include <benchmark.hpp>
+#include <cmath>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+	nl::expected<double, std::string> work(int value)
+	{
+		double x = value;
+		for (int i = 0; i < 200; i++)
+			x = std::sqrt(x + i);
+		return x;
+	}
+}
+
+int main()
+{
+	constexpr std::size_t count = 1 << 18;
+	std::vector<int>      inputs(count);
+	std::iota(inputs.begin(), inputs.end(), 0);
+
+	const std::size_t hardware = std::thread::hardware_concurrency() == 0 ? 1 : std::thread::hardware_concurrency();
+	std::vector<std::size_t> steps;
+	for (std::size_t workers = 1; workers < hardware; workers *= 2)
+		steps.push_back(workers);
+	steps.push_back(hardware);
+
+	double baseline = 0;
+	for (std::size_t workers : steps)
+	{
+		double elapsed = bench::measure(count, [&] { bench::do_not_optimize(nl::parallel_transform(inputs, work, workers)->size()); }, 3);
+		if (workers == 1)
+			baseline = elapsed;
+
+		std::string name = std::to_string(workers) + " workers";
+		std::printf("%-40s %10.2f ns/op, speedup %.2fx\n", name.c_str(), elapsed, baseline / elapsed);
+	}
+
+	double failing = bench::measure(count, [&] {
+		bench::do_not_optimize(nl::parallel_transform(
+		    inputs, [](int value) { return value == 1000 ? nl::expected<double, std::string>(std::string("bad")) : work(value); },
+		    hardware)
+					   .has_value());
+	}, 3);
+	bench::report("early failure, all workers", failing);
+
+	// small inputs measure the fixed cost of a call, which is what the shared pool removes
+	std::vector<int> small(64);
+	std::iota(small.begin(), small.end(), 0);
+	constexpr std::size_t calls = 2000;
+	auto identity = [](int value) { return nl::expected<int, std::string>(value); };
+	double overhead = bench::measure(calls, [&] {
+		for (std::size_t i = 0; i < calls; i++)
+			bench::do_not_optimize(nl::parallel_transform(small, identity, 2)->size());
+	});
+	bench::report("64 elements, 2 workers, per call", overhead);
+	return 0;
+}
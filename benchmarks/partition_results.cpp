@@ -0,0 +1,64 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include -I benchmarks benchmarks/partition_results.cpp && ./a.out
+ */
+
+#include <expected/algorithm.hpp>
+#include <benchmark.hpp>
+#include <random>
+#include <system_error>
+#include <vector>
+
+namespace {
+	using result = nl::expected<long, std::errc>;
+
+	__attribute__((noinline)) std::pair<std::vector<long>, std::vector<std::pair<std::size_t, std::errc>>> two_pass(
+	    const std::vector<result>& results)
+	{
+		std::vector<long> values;
+		for (const auto& r : results)
+		{
+			if (r.has_value())
+				values.push_back(r.value());
+		}
+
+		std::vector<std::pair<std::size_t, std::errc>> errors;
+		for (std::size_t i = 0; i < results.size(); i++)
+		{
+			if (not results[i].has_value())
+				errors.emplace_back(i, results[i].error());
+		}
+		return std::make_pair(std::move(values), std::move(errors));
+	}
+}
+
+int main()
+{
+	constexpr std::size_t count = 1 << 20;
+	const double	      rates[] = {0.01, 0.2, 0.5};
+
+	for (double rate : rates)
+	{
+		std::mt19937		    engine(3);
+		std::bernoulli_distribution failure(rate);
+		std::vector<result>	    results;
+		results.reserve(count);
+		for (std::size_t i = 0; i < count; i++)
+		{
+			if (failure(engine))
+				results.emplace_back(std::errc::io_error);
+			else
+				results.emplace_back(static_cast<long>(i));
+		}
+
+		std::printf("error rate %g\n", rate);
+		bench::report("  two-pass push_back idiom", bench::measure(count, [&] { bench::do_not_optimize(two_pass(results).first.size()); }));
+		bench::report("  nl::partition_results", bench::measure(count, [&] {
+			bench::do_not_optimize(nl::partition_results(results).first.size());
+		}));
+	}
+	return 0;
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include -I benchmarks benchmarks/sequence.cpp && ./a.out
+ */
+
+#include <expected/sequence.hpp>
+#include <benchmark.hpp>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+	using field = nl::expected<int, std::errc>;
+
+	struct record {
+			field f[8];
+	};
+
+	__attribute__((noinline)) long cascade(const record* records, std::size_t count)
+	{
+		long total = 0;
+		for (std::size_t i = 0; i < count; i++)
+		{
+			const field* f = records[i].f;
+			if (not f[0].has_value() || not f[1].has_value() || not f[2].has_value() || not f[3].has_value() || not f[4].has_value() ||
+			    not f[5].has_value() || not f[6].has_value() || not f[7].has_value())
+			{
+				total -= 1;
+				continue;
+			}
+			total += *f[0] + *f[1] + *f[2] + *f[3] + *f[4] + *f[5] + *f[6] + *f[7];
+		}
+		return total;
+	}
+
+	__attribute__((noinline)) long applied(const record* records, std::size_t count)
+	{
+		long total = 0;
+		for (std::size_t i = 0; i < count; i++)
+		{
+			const field* f = records[i].f;
+			auto	     sum = nl::apply_ok([](int a, int b, int c, int d, int e, int g, int h, int j) { return a + b + c + d + e + g + h + j; },
+			    f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7]);
+			total += sum.has_value() ? *sum : -1;
+		}
+		return total;
+	}
+
+	__attribute__((noinline)) long sequenced(const record* records, std::size_t count)
+	{
+		long total = 0;
+		for (std::size_t i = 0; i < count; i++)
+		{
+			const field* f	   = records[i].f;
+			auto	     tuple = nl::sequence(f[0], f[1], f[2], f[3], f[4], f[5], f[6], f[7]);
+			total += tuple.has_value() ? std::get<0>(*tuple) + std::get<7>(*tuple) : -1;
+		}
+		return total;
+	}
+}
+
+int main()
+{
+	constexpr std::size_t count = 1 << 14;
+
+	// failures are spread uniformly over the eight fields; the records fit in cache so the
+	// checks rather than memory bandwidth dominate
+	for (int rate : {0, 1, 10})
+	{
+		std::mt19937		    engine(3);
+		std::bernoulli_distribution failure(rate / 100.0);
+		std::vector<record>	    records(count);
+		for (std::size_t i = 0; i < count; i++)
+		{
+			for (int j = 0; j < 8; j++)
+			{
+				if (failure(engine))
+					records[i].f[j] = field(std::errc::invalid_argument);
+				else
+					records[i].f[j] = field(static_cast<int>(i + j));
+			}
+		}
+
+		std::string suffix = ", " + std::to_string(rate) + "% failing fields";
+		bench::report(("hand-written cascade" + suffix).c_str(),
+		    bench::measure(count, [&] { bench::do_not_optimize(cascade(records.data(), count)); }));
+		bench::report(("nl::apply_ok" + suffix).c_str(), bench::measure(count, [&] { bench::do_not_optimize(applied(records.data(), count)); }));
+		bench::report(("nl::sequence" + suffix).c_str(), bench::measure(count, [&] { bench::do_not_optimize(sequenced(records.data(), count)); }));
+	}
+	return 0;
+}
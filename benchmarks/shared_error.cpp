@@ -0,0 +1,56 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include -I benchmarks benchmarks/shared_error.cpp && ./a.out
+ */
+
+#include <expected/shared_error.hpp>
+#include <benchmark.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+	struct diagnostic {
+			std::string		 message;
+			std::vector<std::string> notes;
+	};
+
+	template<class E>
+	__attribute__((noinline)) std::size_t fan_out(const nl::expected<int, E>& source, std::size_t consumers)
+	{
+		std::vector<nl::expected<int, E>> copies;
+		copies.reserve(consumers);
+		for (std::size_t i = 0; i < consumers; i++)
+			copies.push_back(source);
+		return copies.size();
+	}
+}
+
+int main()
+{
+	constexpr std::size_t consumers = 64;
+	constexpr std::size_t rounds	= 20000;
+
+	diagnostic error{std::string(200, 'd'), {"first note about the failure", "second note about the failure", "third note"}};
+
+	nl::expected<int, diagnostic>					deep   = nl::unexpected(error);
+	nl::expected<int, nl::shared_error<diagnostic>>			shared = nl::unexpected(nl::shared_error<diagnostic>(error));
+	nl::expected<int, nl::shared_error<diagnostic, nl::local_refcount>> local =
+	    nl::unexpected(nl::shared_error<diagnostic, nl::local_refcount>(error));
+
+	bench::report("deep copies", bench::measure(rounds * consumers, [&] {
+		for (std::size_t i = 0; i < rounds; i++)
+			bench::do_not_optimize(fan_out(deep, consumers));
+	}));
+	bench::report("shared_error, atomic refcount", bench::measure(rounds * consumers, [&] {
+		for (std::size_t i = 0; i < rounds; i++)
+			bench::do_not_optimize(fan_out(shared, consumers));
+	}));
+	bench::report("shared_error, local refcount", bench::measure(rounds * consumers, [&] {
+		for (std::size_t i = 0; i < rounds; i++)
+			bench::do_not_optimize(fan_out(local, consumers));
+	}));
+	return 0;
+}
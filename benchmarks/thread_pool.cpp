@@ -0,0 +1,50 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -pthread -I include -I benchmarks benchmarks/thread_pool.cpp && ./a.out
+ */
+
+#include <expected/thread_pool.hpp>
+#include <benchmark.hpp>
+#include <future>
+#include <string>
+#include <vector>
+
+int main()
+{
+	constexpr std::size_t tasks = 20000;
+
+	nl::thread_pool pool;
+	bench::report("nl::thread_pool::submit + get", bench::measure(tasks, [&] {
+		std::vector<nl::expected_future<int, std::string>> futures;
+		futures.reserve(tasks);
+		for (std::size_t i = 0; i < tasks; i++)
+			futures.push_back(pool.submit([i] { return nl::expected<int, std::string>(static_cast<int>(i)); }));
+		long sum = 0;
+		for (auto& future : futures)
+			sum += *future.get();
+		bench::do_not_optimize(sum);
+	}));
+
+	bench::report("nl::when_all", bench::measure(tasks, [&] {
+		std::vector<nl::expected_future<int, std::string>> futures;
+		futures.reserve(tasks);
+		for (std::size_t i = 0; i < tasks; i++)
+			futures.push_back(pool.submit([i] { return nl::expected<int, std::string>(static_cast<int>(i)); }));
+		bench::do_not_optimize(nl::when_all(std::move(futures))->size());
+	}));
+
+	bench::report("std::async + get", bench::measure(tasks, [&] {
+		std::vector<std::future<nl::expected<int, std::string>>> futures;
+		futures.reserve(tasks);
+		for (std::size_t i = 0; i < tasks; i++)
+			futures.push_back(std::async(std::launch::async, [i] { return nl::expected<int, std::string>(static_cast<int>(i)); }));
+		long sum = 0;
+		for (auto& future : futures)
+			sum += *future.get();
+		bench::do_not_optimize(sum);
+	}));
+	return 0;
+}
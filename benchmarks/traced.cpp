@@ -0,0 +1,53 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -fno-omit-frame-pointer -rdynamic -I include -I benchmarks benchmarks/traced.cpp && ./a.out
+ */
+
+#include <expected/traced.hpp>
+#include <benchmark.hpp>
+#include <system_error>
+
+namespace {
+	template<class Result>
+	__attribute__((noinline)) Result leaf(int i)
+	{
+		if (i >= 0)
+			return typename Result::error_type(std::errc::io_error);
+		return 0;
+	}
+
+	template<class Result>
+	__attribute__((noinline)) Result caller(int i)
+	{
+		Result result = leaf<Result>(i);
+		asm volatile("" ::: "memory");
+		return result;
+	}
+
+	template<class Result>
+	void run(const char* name, std::size_t count)
+	{
+		bench::report(name, bench::measure(count, [&] {
+			for (std::size_t i = 0; i < count; i++)
+				bench::do_not_optimize(caller<Result>(static_cast<int>(i)).has_value());
+		}));
+	}
+}
+
+int main()
+{
+	constexpr std::size_t count = 1000000;
+	run<nl::expected<int, std::errc>>("plain error", count);
+	run<nl::expected<int, nl::traced<std::errc>>>("traced error, capture only", count);
+	run<nl::expected<int, nl::traced<std::errc, 4>>>("traced error, depth 4", count);
+
+	nl::expected<int, nl::traced<std::errc>> failed = caller<nl::expected<int, nl::traced<std::errc>>>(1);
+	bench::report("backtrace() symbolization", bench::measure(1000, [&] {
+		for (int i = 0; i < 1000; i++)
+			bench::do_not_optimize(failed.error().backtrace().size());
+	}));
+	return 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include -I benchmarks benchmarks/validated.cpp && ./a.out
+ */
+
+#include <expected/validated.hpp>
+#include <benchmark.hpp>
+#include <random>
+#include <system_error>
+#include <vector>
+
+namespace {
+	using field = nl::expected<int, std::errc>;
+
+	struct record {
+			field name;
+			field age;
+			field email;
+	};
+
+	__attribute__((noinline)) std::size_t with_vectors(const std::vector<record>& records)
+	{
+		std::vector<std::errc> all;
+		long		       sum = 0;
+		for (const auto& r : records)
+		{
+			std::vector<std::errc> errors;
+			if (not r.name)
+				errors.push_back(r.name.error());
+			if (not r.age)
+				errors.push_back(r.age.error());
+			if (not r.email)
+				errors.push_back(r.email.error());
+
+			if (errors.empty())
+				sum += *r.name + *r.age + *r.email;
+			else
+				all.insert(all.end(), errors.begin(), errors.end());
+		}
+		bench::do_not_optimize(sum);
+		return all.size();
+	}
+
+	__attribute__((noinline)) std::size_t with_arena(const std::vector<record>& records, void* buffer, std::size_t size)
+	{
+		nl::monotonic_arena		   arena(buffer, size);
+		nl::validated<long, std::errc> all(arena, 0L);
+		long				   sum = 0;
+		for (const auto& r : records)
+		{
+			auto checked = nl::validate(arena, [](int name, int age, int email) { return name + age + email; }, r.name, r.age, r.email);
+			if (checked)
+				sum += checked.value();
+			else
+				all.merge(std::move(checked));
+		}
+		bench::do_not_optimize(sum);
+		return all.errors().size();
+	}
+}
+
+int main()
+{
+	constexpr std::size_t count = 1000000;
+	std::mt19937	      engine(5);
+	std::bernoulli_distribution failure(0.2);
+
+	auto make_field = [&](int value) { return failure(engine) ? field(std::errc::invalid_argument) : field(value); };
+	std::vector<record> records;
+	records.reserve(count);
+	for (std::size_t i = 0; i < count; i++)
+		records.push_back(record{make_field(1), make_field(2), make_field(3)});
+
+	static unsigned char buffer[1 << 20];
+	bench::report("vector of errors per record", bench::measure(count, [&] { bench::do_not_optimize(with_vectors(records)); }));
+	bench::report("nl::validate into an arena", bench::measure(count, [&] {
+		bench::do_not_optimize(with_arena(records, buffer, sizeof(buffer)));
+	}));
+	return 0;
+}
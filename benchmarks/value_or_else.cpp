@@ -0,0 +1,54 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include -I benchmarks benchmarks/value_or_else.cpp && ./a.out
+ */
+
+#include <expected.hpp>
+#include <benchmark.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+	std::vector<std::string> heavy_default()
+	{
+		return std::vector<std::string>(64, std::string(64, 'x'));
+	}
+}
+
+int main()
+{
+	constexpr std::size_t count = 100000;
+	nl::expected<std::vector<std::string>, int> success = std::vector<std::string>{"ok"};
+	nl::expected<std::vector<std::string>, int> failure = 1;
+
+	bench::report("value_or, success path", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+			bench::do_not_optimize(success.value_or(heavy_default()).size());
+	}));
+	bench::report("value_or_else, success path", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+			bench::do_not_optimize(success.value_or_else(heavy_default).size());
+	}));
+	bench::report("value_or, error path", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+			bench::do_not_optimize(failure.value_or(heavy_default()).size());
+	}));
+	bench::report("value_or_else, error path", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+			bench::do_not_optimize(failure.value_or_else(heavy_default).size());
+	}));
+
+	nl::expected<std::string, int> moved_from = std::string(256, 'v');
+	bench::report("rvalue value_or, moves the payload", bench::measure(count, [&] {
+		for (std::size_t i = 0; i < count; i++)
+		{
+			std::string text = std::move(moved_from).value_or(std::string());
+			bench::do_not_optimize(text.size());
+			moved_from = std::move(text);
+		}
+	}));
+	return 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O3 -I include -I benchmarks benchmarks/values_or.cpp && ./a.out
+ */
+
+#include <expected.hpp>
+#include <benchmark.hpp>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+	__attribute__((noinline)) void branching(const nl::expected<int, std::errc>* first, std::size_t count, int fallback, int* out)
+	{
+		for (std::size_t i = 0; i < count; i++)
+			out[i] = first[i].has_value() ? *first[i] : fallback;
+	}
+}
+
+int main()
+{
+	constexpr std::size_t count = 1 << 22;
+	std::vector<int>      outputs(count);
+
+	for (int rate = 0; rate <= 50; rate += 10)
+	{
+		std::mt19937		    engine(42);
+		std::bernoulli_distribution failure(rate / 100.0);
+
+		std::vector<nl::expected<int, std::errc>> inputs;
+		inputs.reserve(count);
+		for (std::size_t i = 0; i < count; i++)
+		{
+			if (failure(engine))
+				inputs.emplace_back(std::errc::io_error);
+			else
+				inputs.emplace_back(static_cast<int>(i));
+		}
+
+		std::string branchy = "branching loop, " + std::to_string(rate) + "% errors";
+		std::string select  = "nl::values_or, " + std::to_string(rate) + "% errors";
+		bench::report(branchy.c_str(), bench::measure(count, [&] { branching(inputs.data(), count, -1, outputs.data()); }));
+		bench::report(select.c_str(), bench::measure(count, [&] { nl::values_or(inputs.data(), count, -1, outputs.data()); }));
+	}
+	return 0;
+}
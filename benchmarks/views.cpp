@@ -0,0 +1,75 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include -I benchmarks benchmarks/views.cpp && ./a.out
+ */
+
+#include <expected/views.hpp>
+#include <benchmark.hpp>
+#include <random>
+#include <ranges>
+#include <system_error>
+#include <vector>
+
+int main()
+{
+	using result = nl::expected<long, std::errc>;
+
+	constexpr std::size_t count = 1 << 22;
+	std::mt19937	      engine(11);
+	std::bernoulli_distribution failure(0.2);
+
+	std::vector<result> results;
+	results.reserve(count);
+	for (std::size_t i = 0; i < count; i++)
+	{
+		if (failure(engine))
+			results.emplace_back(std::errc::io_error);
+		else
+			results.emplace_back(static_cast<long>(i));
+	}
+
+	bench::report("filter | transform(value())", bench::measure(count, [&] {
+		long sum = 0;
+		for (long value : results | std::views::filter([](const result& r) { return r.has_value(); })
+					  | std::views::transform([](const result& r) { return r.value(); }))
+			sum += value;
+		bench::do_not_optimize(sum);
+	}));
+	bench::report("nl::views::values", bench::measure(count, [&] {
+		long sum = 0;
+		for (long value : results | nl::views::values)
+			sum += value;
+		bench::do_not_optimize(sum);
+	}));
+
+	bench::report("filter | transform(error())", bench::measure(count, [&] {
+		std::size_t errors = 0;
+		for (std::errc error : results | std::views::filter([](const result& r) { return not r.has_value(); })
+					   | std::views::transform([](const result& r) { return r.error(); }))
+			errors += error == std::errc::io_error;
+		bench::do_not_optimize(errors);
+	}));
+	bench::report("nl::views::errors", bench::measure(count, [&] {
+		std::size_t errors = 0;
+		for (std::errc error : results | nl::views::errors)
+			errors += error == std::errc::io_error;
+		bench::do_not_optimize(errors);
+	}));
+
+	bench::report("transform(has_value ? value * 2 : error)", bench::measure(count, [&] {
+		long sum = 0;
+		for (const result& r : results | std::views::transform([](const result& r) { return r.has_value() ? result(*r * 2) : r; }))
+			sum += r.value_or(0);
+		bench::do_not_optimize(sum);
+	}));
+	bench::report("nl::views::transform_ok", bench::measure(count, [&] {
+		long sum = 0;
+		for (const result& r : results | nl::views::transform_ok([](long value) { return value * 2; }))
+			sum += r.value_or(0);
+		bench::do_not_optimize(sum);
+	}));
+	return 0;
+}
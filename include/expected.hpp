@@ -11,6 +11,36 @@
 #include <type_traits>
 #include <new>
 #include <stdexcept>
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#if defined(NL_EXPECTED_SOURCE_LOCATION) && __cplusplus >= 202002L && defined(__has_include)
+#if __has_include(<source_location>)
+#include <source_location>
+#endif
+#endif
+
+#if defined(NL_EXPECTED_SOURCE_LOCATION) && defined(__cpp_lib_source_location)
+#define _source_location
+#define _location_param , std::source_location location = std::source_location::current()
+#define _location_arg , location
+#define _location_init , _location(location)
+#define _location_from(other) , _location(other.error_location())
+#define _location_with(location) , location
+#if defined(__GNUC__) || defined(__clang__)
+#define _abi_tag __attribute__((abi_tag("located")))
+#else
+#define _abi_tag
+#endif
+#else
+#define _location_param
+#define _location_arg
+#define _location_init
+#define _location_from(other)
+#define _location_with(location)
+#endif
 
 #if __cplusplus >= 201703L
 #define _constexpr constexpr
@@ -29,9 +59,113 @@
 #endif
 
 namespace nl {
+#if defined(_source_location)
+	// capturing the location changes the layout of expected, so that mode lives in its own
+	// inline namespace: translation units built with and without NL_EXPECTED_SOURCE_LOCATION
+	// then mangle every entity differently and fail to link against each other instead of
+	// silently disagreeing on sizeof(expected). the abi tag carries the same difference into
+	// functions that only return one of these types, whose return type is not mangled
+	inline namespace located _abi_tag {
+#endif
 
 	struct monostate {};
 
+	namespace detail {
+		// types whose every byte belongs to the value, so copying them into wider words never
+		// reads padding
+		template<class T>
+		struct has_no_padding
+#if defined(__cpp_lib_has_unique_object_representations)
+		    : std::integral_constant<bool, std::has_unique_object_representations<T>::value ||
+						       (std::is_floating_point<T>::value && sizeof(T) <= sizeof(double))> {};
+#else
+		    : std::integral_constant<bool, std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value ||
+						       (std::is_floating_point<T>::value && sizeof(T) <= sizeof(double))> {};
+#endif
+
+		// the blend reads sizeof(T) bytes of the storage whichever member is active, so an error
+		// must cover all of them with initialized bytes for the read to be defined
+		template<class T, class E>
+		struct is_branchless_selectable
+		    : std::integral_constant<bool, std::is_trivial<T>::value && sizeof(T) <= 2 * sizeof(void*) &&
+						       std::is_trivially_copyable<E>::value && sizeof(E) >= sizeof(T) &&
+						       has_no_padding<T>::value && has_no_padding<E>::value> {};
+
+		template<std::size_t Size>
+		struct blend_word {
+				using type = typename std::conditional<Size % 8 == 0, std::uint64_t,
+				    typename std::conditional<Size % 4 == 0, std::uint32_t,
+					typename std::conditional<Size % 2 == 0, std::uint16_t, std::uint8_t>::type>::type>::type;
+		};
+
+		struct expected_access;
+
+		template<class E>
+		struct is_error_wrapper : std::false_type {};
+
+		template<class E, class G, bool = is_error_wrapper<E>::value>
+		struct wraps_error : std::false_type {};
+
+		template<class E, class G>
+		struct wraps_error<E, G, true> : std::is_same<typename std::decay<G>::type, typename E::element_type> {};
+
+		template<class E, class G>
+		struct accepts_error : wraps_error<E, G> {};
+
+		template<class E>
+		auto context_test(int) -> decltype(std::declval<E&>().add_context("", std::int64_t()), std::true_type());
+
+		template<class E>
+		std::false_type context_test(long);
+
+		template<class E>
+		struct has_context : decltype(context_test<E>(0)) {};
+
+		template<class X, class Alloc, class... Args>
+		void construct_with_allocator(std::integral_constant<int, 0>, X* location, const Alloc&, Args&&... args)
+		{
+			new (location) X(std::forward<Args>(args)...);
+		}
+
+		template<class X, class Alloc, class... Args>
+		void construct_with_allocator(std::integral_constant<int, 1>, X* location, const Alloc& alloc, Args&&... args)
+		{
+			new (location) X(std::allocator_arg, alloc, std::forward<Args>(args)...);
+		}
+
+		template<class X, class Alloc, class... Args>
+		void construct_with_allocator(std::integral_constant<int, 2>, X* location, const Alloc& alloc, Args&&... args)
+		{
+			new (location) X(std::forward<Args>(args)..., alloc);
+		}
+
+		template<class X, class Alloc, class... Args>
+		void uses_allocator_construct(X* location, const Alloc& alloc, Args&&... args)
+		{
+			using strategy = std::integral_constant<int,
+			    not std::uses_allocator<X, Alloc>::value ? 0 : std::is_constructible<X, std::allocator_arg_t, const Alloc&, Args...>::value ? 1 : 2>;
+			construct_with_allocator(strategy(), location, alloc, std::forward<Args>(args)...);
+		}
+
+		template<class Current, class Source>
+		auto assignment_allocator(const Current& current, const Source&, int, int) -> decltype(current.get_allocator())
+		{
+			return current.get_allocator();
+		}
+
+		template<class Current, class Source>
+		auto assignment_allocator(const Current&, const Source& source, int, long) -> decltype(source.get_allocator())
+		{
+			return source.get_allocator();
+		}
+
+		template<class Current, class Source>
+		std::allocator<char> assignment_allocator(const Current&, const Source&, long, long)
+		{
+			return std::allocator<char>();
+		}
+	}
+
 	template<class T = monostate, class E = monostate>
 	class expected {
 		private:
@@ -42,17 +176,118 @@ namespace nl {
 					E _error;
 			};
 
+#if defined(_source_location)
+			std::source_location _location;
+#endif
+
+			_constexpr T _select_value(std::false_type, const T& fallback) const
+			{
+				if (_has_value)
+					return _value;
+				else
+					return fallback;
+			}
+
+			_constexpr T _select_value(std::true_type, const T& fallback) const noexcept
+			{
+#if defined(__cpp_lib_is_constant_evaluated)
+				if (std::is_constant_evaluated())
+					return this->_select_value(std::false_type(), fallback);
+#endif
+				using word = typename detail::blend_word<sizeof(T)>::type;
+				constexpr std::size_t words = sizeof(T) / sizeof(word);
+
+				word selected[words];
+				word other[words];
+				std::memcpy(selected, std::addressof(_value), sizeof(T));
+				std::memcpy(other, std::addressof(fallback), sizeof(T));
+				const word mask = static_cast<word>(word(0) - static_cast<word>(not _has_value));
+				for (std::size_t i = 0; i < words; i++)
+					selected[i] = static_cast<word>(selected[i] ^ ((selected[i] ^ other[i]) & mask));
+
+				T value = T();
+				std::memcpy(std::addressof(value), selected, sizeof(T));
+				return value;
+			}
+
+			// switches the active member from current to next; next is built with the allocator of the
+			// member it replaces, or of the source when that one has none, so pmr payloads stay on
+			// their resource across assignment
+			template<class Current, class Next, class Source>
+			void _reinit(Current& current, Next& next, Source&& source)
+			{
+				// the backup path needs a nothrow current; when neither member moves without throwing, the
+				// temporary path keeps the baseline behaviour, where only the final move is unguarded
+				using direct   = std::integral_constant<bool,
+				      std::is_nothrow_move_constructible<Next>::value || not std::is_nothrow_move_constructible<Current>::value>;
+				auto allocator = detail::assignment_allocator(current, source, 0, 0);
+				this->_reinit(direct(), allocator, current, next, std::forward<Source>(source));
+				_has_value = not _has_value;
+			}
+
+			template<class Alloc, class Current, class Next, class Source>
+			void _reinit(std::true_type, const Alloc& allocator, Current& current, Next& next, Source&& source)
+			{
+				union storage {
+						Next object;
+
+						storage()
+						{
+						}
+
+						~storage()
+						{
+						}
+				} temporary;
+
+				detail::uses_allocator_construct(std::addressof(temporary.object), allocator, std::forward<Source>(source));
+				current.~Current();
+				new (std::addressof(next)) Next(std::move(temporary.object));
+				temporary.object.~Next();
+			}
+
+			template<class Alloc, class Current, class Next, class Source>
+			void _reinit(std::false_type, const Alloc& allocator, Current& current, Next& next, Source&& source)
+			{
+				Current backup(std::move(current));
+				current.~Current();
+				try
+				{
+					detail::uses_allocator_construct(std::addressof(next), allocator, std::forward<Source>(source));
+				}
+				catch (...)
+				{
+					new (std::addressof(current)) Current(std::move(backup));
+					throw;
+				}
+			}
+
+			friend struct detail::expected_access;
+
 		public:
+			using value_type = T;
+			using error_type = E;
+
 			_constexpr expected(const T& t) : _has_value(true)
 			{
 				_construct_at(std::addressof(_value), T(t));
 			}
 
-			_constexpr expected(const E& e) : _has_value(false)
+			_constexpr expected(const E& e _location_param) : _has_value(false) _location_init
 			{
 				_construct_at(std::addressof(_error), E(e));
 			}
 
+			_constexpr expected(T&& t) : _has_value(true)
+			{
+				_construct_at(std::addressof(_value), T(std::move(t)));
+			}
+
+			_constexpr expected(E&& e _location_param) : _has_value(false) _location_init
+			{
+				_construct_at(std::addressof(_error), E(std::move(e)));
+			}
+
 			_constexpr expected() : _has_value(true)
 			{
 				static_assert(std::is_default_constructible<T>::value, "");
@@ -62,17 +297,35 @@ namespace nl {
 			_constexpr expected& operator=(const expected& other)
 			{
 				static_assert(std::is_copy_assignable<T>::value && std::is_copy_assignable<E>::value, "");
-				if (this != &other)
+				if (this == &other)
+					return *this;
+
+#if defined(__cpp_lib_is_constant_evaluated)
+				if (std::is_constant_evaluated())
 				{
 					this->~expected();
 					_construct_at(this, expected(other));
+					return *this;
 				}
+#endif
+
+				if (_has_value && other._has_value)
+					_value = other._value;
+				else if (not _has_value && not other._has_value)
+					_error = other._error;
+				else if (_has_value)
+					this->_reinit(_value, _error, other._error);
+				else
+					this->_reinit(_error, _value, other._value);
 
+#if defined(_source_location)
+				_location = other._location;
+#endif
 				return *this;
 			}
 
 			template<class U>
-			_constexpr expected(const expected<U, E>& other) : _has_value(other.has_value())
+			_constexpr expected(const expected<U, E>& other) : _has_value(other.has_value()) _location_from(other)
 			{
 				static_assert(std::is_same<U, nl::monostate>::value, "no available conversion between the provided value types");
 				static_assert(std::is_copy_constructible<T>::value && std::is_copy_constructible<E>::value, "");
@@ -86,7 +339,124 @@ namespace nl {
 				}
 			}
 
-			_constexpr expected(const expected& other) : _has_value(other.has_value())
+			template<class U>
+			_constexpr expected(expected<U, E>&& other) : _has_value(other.has_value()) _location_from(other)
+			{
+				static_assert(std::is_same<U, nl::monostate>::value, "no available conversion between the provided value types");
+				static_assert(std::is_default_constructible<T>::value && std::is_move_constructible<E>::value, "");
+				if (_has_value)
+				{
+					_construct_at(std::addressof(_value), T());
+				}
+				else
+				{
+					_construct_at(std::addressof(_error), E(std::move(other).error()));
+				}
+			}
+
+			template<class G,
+			    class = typename std::enable_if<detail::wraps_error<E, G>::value && not std::is_same<typename std::decay<G>::type, T>::value>::type>
+			_constexpr expected(G&& g _location_param) : _has_value(false) _location_init
+			{
+				_construct_at(std::addressof(_error), E(std::forward<G>(g)));
+			}
+
+			template<class G, class = typename std::enable_if<detail::accepts_error<E, G>::value>::type>
+			_constexpr expected(const expected<monostate, G>& other) : _has_value(other.has_value()) _location_from(other)
+			{
+				if (_has_value)
+				{
+					_construct_at(std::addressof(_value), T());
+				}
+				else
+				{
+					_construct_at(std::addressof(_error), E(other.error()));
+				}
+			}
+
+			template<class G, class = typename std::enable_if<detail::accepts_error<E, G>::value>::type>
+			_constexpr expected(expected<monostate, G>&& other) : _has_value(other.has_value()) _location_from(other)
+			{
+				if (_has_value)
+				{
+					_construct_at(std::addressof(_value), T());
+				}
+				else
+				{
+					_construct_at(std::addressof(_error), E(std::move(other).error()));
+				}
+			}
+
+			template<class Alloc>
+			expected(std::allocator_arg_t, const Alloc& alloc, const T& t) : _has_value(true)
+			{
+				detail::uses_allocator_construct(std::addressof(_value), alloc, t);
+			}
+
+			template<class Alloc>
+			expected(std::allocator_arg_t, const Alloc& alloc, T&& t) : _has_value(true)
+			{
+				detail::uses_allocator_construct(std::addressof(_value), alloc, std::move(t));
+			}
+
+			template<class Alloc>
+			expected(std::allocator_arg_t, const Alloc& alloc, const E& e _location_param) : _has_value(false) _location_init
+			{
+				detail::uses_allocator_construct(std::addressof(_error), alloc, e);
+			}
+
+			template<class Alloc>
+			expected(std::allocator_arg_t, const Alloc& alloc, E&& e _location_param) : _has_value(false) _location_init
+			{
+				detail::uses_allocator_construct(std::addressof(_error), alloc, std::move(e));
+			}
+
+			template<class Alloc>
+			expected(std::allocator_arg_t, const Alloc& alloc) : _has_value(true)
+			{
+				static_assert(std::is_default_constructible<T>::value, "");
+				detail::uses_allocator_construct(std::addressof(_value), alloc);
+			}
+
+			template<class Alloc>
+			expected(std::allocator_arg_t, const Alloc& alloc, const expected& other) : _has_value(other._has_value) _location_from(other)
+			{
+				if (_has_value)
+					detail::uses_allocator_construct(std::addressof(_value), alloc, other._value);
+				else
+					detail::uses_allocator_construct(std::addressof(_error), alloc, other._error);
+			}
+
+			template<class Alloc>
+			expected(std::allocator_arg_t, const Alloc& alloc, expected&& other) : _has_value(other._has_value) _location_from(other)
+			{
+				if (_has_value)
+					detail::uses_allocator_construct(std::addressof(_value), alloc, std::move(other._value));
+				else
+					detail::uses_allocator_construct(std::addressof(_error), alloc, std::move(other._error));
+			}
+
+			template<class Alloc, class U>
+			expected(std::allocator_arg_t, const Alloc& alloc, const expected<U, E>& other) : _has_value(other.has_value()) _location_from(other)
+			{
+				static_assert(std::is_same<U, nl::monostate>::value, "no available conversion between the provided value types");
+				if (_has_value)
+					detail::uses_allocator_construct(std::addressof(_value), alloc);
+				else
+					detail::uses_allocator_construct(std::addressof(_error), alloc, other.error());
+			}
+
+			template<class Alloc, class U>
+			expected(std::allocator_arg_t, const Alloc& alloc, expected<U, E>&& other) : _has_value(other.has_value()) _location_from(other)
+			{
+				static_assert(std::is_same<U, nl::monostate>::value, "no available conversion between the provided value types");
+				if (_has_value)
+					detail::uses_allocator_construct(std::addressof(_value), alloc);
+				else
+					detail::uses_allocator_construct(std::addressof(_error), alloc, std::move(other).error());
+			}
+
+			_constexpr expected(const expected& other) : _has_value(other.has_value()) _location_from(other)
 			{
 				static_assert(std::is_copy_constructible<T>::value && std::is_copy_constructible<E>::value, "");
 				if (_has_value)
@@ -99,7 +469,9 @@ namespace nl {
 				}
 			}
 
-			_constexpr expected(const expected&& other) noexcept : _has_value(other._has_value)
+			_constexpr expected(expected&& other) noexcept(
+			    std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_constructible<E>::value)
+			    : _has_value(other._has_value) _location_from(other)
 			{
 				static_assert(std::is_move_constructible<T>::value && std::is_move_constructible<E>::value, "");
 				if (this->has_value())
@@ -112,15 +484,35 @@ namespace nl {
 				}
 			}
 
-			_constexpr expected& operator=(const expected&& other) noexcept
+			_constexpr expected& operator=(expected&& other) noexcept(
+			    std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_assignable<T>::value &&
+			    std::is_nothrow_move_constructible<E>::value && std::is_nothrow_move_assignable<E>::value)
 			{
 				static_assert(std::is_move_assignable<T>::value && std::is_move_assignable<E>::value, "");
-				if (this != &other)
+				if (this == &other)
+					return *this;
+
+#if defined(__cpp_lib_is_constant_evaluated)
+				if (std::is_constant_evaluated())
 				{
 					this->~expected();
 					_construct_at(this, expected(std::move(other)));
+					return *this;
 				}
+#endif
 
+				if (_has_value && other._has_value)
+					_value = std::move(other._value);
+				else if (not _has_value && not other._has_value)
+					_error = std::move(other._error);
+				else if (_has_value)
+					this->_reinit(_value, _error, std::move(other._error));
+				else
+					this->_reinit(_error, _value, std::move(other._value));
+
+#if defined(_source_location)
+				_location = other._location;
+#endif
 				return *this;
 			}
 			
@@ -142,6 +534,13 @@ namespace nl {
 				return this->has_value();
 			}
 
+#if defined(_source_location)
+			constexpr std::source_location error_location() const noexcept
+			{
+				return _location;
+			}
+#endif
+
 			_constexpr const T& value() const&
 			{
 				if (not _has_value)
@@ -214,11 +613,43 @@ namespace nl {
 				return std::move(_error);
 			}
 
+			_constexpr const T& operator*() const& noexcept
+			{
+				return _value;
+			}
+
+			_constexpr T& operator*() & noexcept
+			{
+				return _value;
+			}
+
+			_constexpr const T&& operator*() const&& noexcept
+			{
+				return std::move(_value);
+			}
+
+			_constexpr T&& operator*() && noexcept
+			{
+				return std::move(_value);
+			}
+
+			_constexpr const T* operator->() const noexcept
+			{
+				return std::addressof(_value);
+			}
+
+			_constexpr T* operator->() noexcept
+			{
+				return std::addressof(_value);
+			}
+
 			template<class U = typename std::remove_cv<T>::type>
 			_constexpr T value_or(U&& other) const&
 			{
 				static_assert(std::is_convertible<U, T>::value, "the provided type must be convertible to the value type");
-				if (_has_value)
+				if (detail::is_branchless_selectable<T, E>::value)
+					return this->_select_value(detail::is_branchless_selectable<T, E>(), static_cast<T>(std::forward<U>(other)));
+				else if (_has_value)
 					return _value;
 				else
 					return static_cast<T>(std::forward<U>(other));
@@ -233,16 +664,170 @@ namespace nl {
 				else
 					return static_cast<E>(std::forward<U>(other));
 			}
+
+			template<class U = typename std::remove_cv<T>::type>
+			_constexpr T value_or(U&& other) &&
+			{
+				static_assert(std::is_convertible<U, T>::value, "the provided type must be convertible to the value type");
+				if (detail::is_branchless_selectable<T, E>::value)
+					return this->_select_value(detail::is_branchless_selectable<T, E>(), static_cast<T>(std::forward<U>(other)));
+				else if (_has_value)
+					return std::move(_value);
+				else
+					return static_cast<T>(std::forward<U>(other));
+			}
+
+			template<class U = typename std::remove_cv<E>::type>
+			_constexpr E error_or(U&& other) &&
+			{
+				static_assert(std::is_convertible<U, E>::value, "the provided type must be convertible to the error type");
+				if (not _has_value)
+					return std::move(_error);
+				else
+					return static_cast<E>(std::forward<U>(other));
+			}
+
+			template<class F>
+			_constexpr T value_or_else(F&& f) const&
+			{
+				static_assert(std::is_convertible<decltype(std::forward<F>(f)()), T>::value,
+				    "the provided function must return a type convertible to the value type");
+				if (_has_value)
+					return _value;
+				else
+					return static_cast<T>(std::forward<F>(f)());
+			}
+
+			template<class F>
+			_constexpr T value_or_else(F&& f) &&
+			{
+				static_assert(std::is_convertible<decltype(std::forward<F>(f)()), T>::value,
+				    "the provided function must return a type convertible to the value type");
+				if (_has_value)
+					return std::move(_value);
+				else
+					return static_cast<T>(std::forward<F>(f)());
+			}
+
+			template<class F>
+			_constexpr E error_or_else(F&& f) const&
+			{
+				static_assert(std::is_convertible<decltype(std::forward<F>(f)()), E>::value,
+				    "the provided function must return a type convertible to the error type");
+				if (not _has_value)
+					return _error;
+				else
+					return static_cast<E>(std::forward<F>(f)());
+			}
+
+			template<class F>
+			_constexpr E error_or_else(F&& f) &&
+			{
+				static_assert(std::is_convertible<decltype(std::forward<F>(f)()), E>::value,
+				    "the provided function must return a type convertible to the error type");
+				if (not _has_value)
+					return std::move(_error);
+				else
+					return static_cast<E>(std::forward<F>(f)());
+			}
+
+			template<class G = E, class = typename std::enable_if<detail::has_context<G>::value>::type>
+			expected& context(const char* frame, std::int64_t argument = 0) &
+			{
+				if (not _has_value)
+					_error.add_context(frame, argument);
+				return *this;
+			}
+
+			template<class G = E, class = typename std::enable_if<detail::has_context<G>::value>::type>
+			expected context(const char* frame, std::int64_t argument = 0) &&
+			{
+				if (not _has_value)
+					_error.add_context(frame, argument);
+				return std::move(*this);
+			}
 	};
 
+	namespace detail {
+		struct expected_access {
+				template<class X>
+				static auto error(X&& result) noexcept -> decltype((std::forward<X>(result)._error))
+				{
+					return std::forward<X>(result)._error;
+				}
+		};
+	}
+
+	namespace detail {
+		template<class T, class E>
+		void values_or(std::false_type, const expected<T, E>* first, std::size_t count, const T& fallback, T* out)
+		{
+			for (std::size_t i = 0; i < count; i++)
+				out[i] = first[i].value_or(fallback);
+		}
+
+		template<class T, class E>
+		void values_or(std::true_type, const expected<T, E>* first, std::size_t count, const T& fallback, T* out)
+		{
+			using word = typename blend_word<sizeof(T)>::type;
+			constexpr std::size_t words = sizeof(T) / sizeof(word);
+			constexpr std::size_t block = 64;
+
+			word other[words];
+			std::memcpy(other, std::addressof(fallback), sizeof(T));
+
+			// the flags and the payloads are gathered in separate passes so that neither loop mixes
+			// element sizes, which is what keeps GCC from vectorizing a single fused loop
+			for (std::size_t base = 0; base < count; base += block)
+			{
+				const std::size_t length = count - base < block ? count - base : block;
+				unsigned char present[block];
+				for (std::size_t i = 0; i < length; i++)
+					present[i] = static_cast<unsigned char>(first[base + i].has_value());
+
+				for (std::size_t i = 0; i < length; i++)
+				{
+					word selected[words];
+					std::memcpy(selected, std::addressof(*first[base + i]), sizeof(T));
+					const word mask = static_cast<word>(word(0) - static_cast<word>(present[i] ^ 1));
+					for (std::size_t j = 0; j < words; j++)
+						selected[j] = static_cast<word>(selected[j] ^ ((selected[j] ^ other[j]) & mask));
+					std::memcpy(out + base + i, selected, sizeof(T));
+				}
+			}
+		}
+	}
+
+	template<class T, class E>
+	void values_or(const expected<T, E>* first, std::size_t count, const T& fallback, T* out)
+	{
+		detail::values_or(detail::is_branchless_selectable<T, E>(), first, count, fallback, out);
+	}
+
 	template<class E>
-	_constexpr_destructor expected<monostate, E> unexpected(const E& e)
+	_constexpr_destructor expected<monostate, E> unexpected(const E& e _location_param)
+	{
+		return expected<monostate, E>(e _location_arg);
+	}
+
+	template<class E, class = typename std::enable_if<not std::is_lvalue_reference<E>::value>::type>
+	_constexpr_destructor expected<monostate, E> unexpected(E&& e _location_param)
 	{
-		return expected<monostate, E>(e);
+		return expected<monostate, E>(std::move(e) _location_arg);
 	}
 
-	_constexpr_destructor expected<monostate, std::string> unexpected(const char* e)
+	inline _constexpr_destructor expected<monostate, std::string> unexpected(const char* e _location_param)
 	{
-		return unexpected<std::string>(std::string(e));
+		return unexpected<std::string>(std::string(e) _location_arg);
+	}
+
+#if defined(_source_location)
 	}
+#endif
+}
+
+namespace std {
+	template<class T, class E, class Alloc>
+	struct uses_allocator<nl::expected<T, E>, Alloc>
+	    : integral_constant<bool, uses_allocator<T, Alloc>::value || uses_allocator<E, Alloc>::value> {};
 }
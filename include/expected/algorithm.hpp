@@ -0,0 +1,185 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <iterator>
+#include <vector>
+
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	namespace detail {
+		template<class Range>
+		struct range_result {
+				using type = typename std::decay<decltype(*std::begin(std::declval<Range&>()))>::type;
+		};
+
+		// only allocator-aware containers are known to own their elements; any other range passed
+		// by value, a view or a wrapper around a pair of iterators, may still refer to the caller's
+		template<class Range>
+		auto owns_storage(int)
+		    -> decltype(std::declval<typename Range::value_type&>(), std::declval<typename Range::allocator_type&>(), std::true_type());
+
+		template<class Range>
+		std::false_type owns_storage(long);
+
+		template<class Range>
+		struct owns_elements : decltype(owns_storage<Range>(0)) {};
+
+#if defined(__cpp_lib_ranges)
+		template<class Iterator>
+		struct is_multipass : std::integral_constant<bool, std::forward_iterator<Iterator>> {};
+#else
+		template<class Iterator>
+		struct is_multipass
+		    : std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category> {};
+#endif
+
+		// elements are moved out only when the range hands out rvalues or prvalues, or when the range
+		// is an owning container passed as an rvalue
+		template<class Range>
+		struct moves_elements
+		    : std::integral_constant<bool,
+			  not std::is_lvalue_reference<decltype(*std::begin(std::declval<Range&>()))>::value ||
+			      (not std::is_lvalue_reference<Range>::value && owns_elements<typename std::remove_cv<Range>::type>::value)> {};
+
+		template<class Range, class X>
+		typename std::conditional<moves_elements<Range>::value, X&&, X&>::type forward_element(X& x) noexcept
+		{
+			return static_cast<typename std::conditional<moves_elements<Range>::value, X&&, X&>::type>(x);
+		}
+
+		template<class Iterator, class Sentinel>
+		std::pair<std::size_t, std::size_t> count_values(const Iterator&, const Sentinel&, std::false_type)
+		{
+			return std::make_pair(std::size_t(0), std::size_t(0));
+		}
+
+		template<class Iterator, class Sentinel>
+		std::pair<std::size_t, std::size_t> count_values(Iterator first, const Sentinel& last, std::true_type)
+		{
+			std::size_t values = 0;
+			std::size_t total  = 0;
+			for (; first != last; ++first, ++total)
+				values += (*first).has_value();
+			return std::make_pair(values, total);
+		}
+	}
+
+	template<class InputIt, class Sentinel, class ValueOut, class ErrorOut>
+	std::pair<ValueOut, ErrorOut> partition_results(InputIt first, Sentinel last, ValueOut values_out, ErrorOut errors_out)
+	{
+		for (std::size_t index = 0; first != last; ++first, ++index)
+		{
+			auto&& result = *first;
+			if (result.has_value())
+			{
+				*values_out = *std::forward<decltype(result)>(result);
+				++values_out;
+			}
+			else
+			{
+				*errors_out = std::make_pair(index, std::forward<decltype(result)>(result).error());
+				++errors_out;
+			}
+		}
+		return std::make_pair(values_out, errors_out);
+	}
+
+	template<class Range, class Result = typename detail::range_result<Range>::type,
+	    class ValueAllocator = std::allocator<typename Result::value_type>,
+	    class ErrorAllocator = std::allocator<std::pair<std::size_t, typename Result::error_type>>>
+	std::pair<std::vector<typename Result::value_type, ValueAllocator>,
+	    std::vector<std::pair<std::size_t, typename Result::error_type>, ErrorAllocator>>
+	    partition_results(Range&& range, const ValueAllocator& value_allocator = ValueAllocator(),
+		const ErrorAllocator& error_allocator = ErrorAllocator())
+	{
+		using iterator = decltype(std::begin(range));
+
+		std::vector<typename Result::value_type, ValueAllocator>			values(value_allocator);
+		std::vector<std::pair<std::size_t, typename Result::error_type>, ErrorAllocator> errors(error_allocator);
+
+		// begin() is taken once; only a multipass range is walked a second time to size the outputs
+		iterator first = std::begin(range);
+		auto	 last  = std::end(range);
+
+		std::pair<std::size_t, std::size_t> counts = detail::count_values(first, last, detail::is_multipass<iterator>());
+		values.reserve(counts.first);
+		errors.reserve(counts.second - counts.first);
+
+		std::size_t index = 0;
+		for (; first != last; ++first, ++index)
+		{
+			auto&& result = *first;
+			if (result.has_value())
+				values.push_back(*detail::forward_element<Range>(result));
+			else
+				errors.emplace_back(index, detail::forward_element<Range>(result).error());
+		}
+		return std::make_pair(std::move(values), std::move(errors));
+	}
+
+	namespace detail {
+		// reserves only for sized forward ranges; size() on a single-pass range may have to consume it
+		template<class Container, class Range>
+		auto reserve_for(Container& container, Range& range, std::true_type, int) -> decltype(container.reserve(range.size()), void())
+		{
+			container.reserve(range.size());
+		}
+
+		template<class Container, class Range, class Multipass>
+		void reserve_for(Container&, Range&, Multipass, long)
+		{
+		}
+	}
+
+	template<class Container, class Range, class Result = typename detail::range_result<Range>::type>
+	expected<Container, typename Result::error_type> collect(Range&& range)
+	{
+		using error_type = typename Result::error_type;
+
+		using iterator	 = decltype(std::begin(range));
+
+		Container container;
+		iterator  first = std::begin(range);
+		auto	  last	= std::end(range);
+		detail::reserve_for(container, range, typename detail::is_multipass<iterator>::type(), 0);
+		for (; first != last; ++first)
+		{
+			auto&& result = *first;
+			if (not result.has_value())
+				return expected<Container, error_type>(
+				    detail::forward_element<Range>(result).error() _location_with(result.error_location()));
+			container.insert(container.end(), *detail::forward_element<Range>(result));
+		}
+		return expected<Container, error_type>(std::move(container));
+	}
+
+#if __cplusplus >= 202002L
+	template<std::ranges::contiguous_range In, std::ranges::contiguous_range Out>
+	requires std::ranges::sized_range<In> && std::ranges::sized_range<Out>
+	void values_or(In&& in, const typename std::ranges::range_value_t<In>::value_type& fallback, Out&& out)
+	{
+		if (std::ranges::size(out) < std::ranges::size(in))
+		{
+			throw std::runtime_error("The output range is smaller than the input range");
+		}
+		nl::values_or(std::ranges::data(in), std::ranges::size(in), fallback, std::ranges::data(out));
+	}
+#endif
+
+#if defined(_source_location)
+	}
+#endif
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <expected/detail/backoff.hpp>
+#include <atomic>
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	template<class T, class E>
+	class atomic_expected {
+		private:
+			static constexpr int state_empty   = 0;
+			static constexpr int state_writing = 1;
+			static constexpr int state_ready   = 2;
+
+			std::atomic<int> _state;
+
+			union {
+					expected<T, E> _result;
+			};
+
+			template<class... Args>
+			bool publish(Args&&... args)
+			{
+				int expected_state = state_empty;
+				if (not _state.compare_exchange_strong(expected_state, state_writing, std::memory_order_relaxed))
+					return false;
+
+				try
+				{
+					new (std::addressof(_result)) expected<T, E>(std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					_state.store(state_empty, std::memory_order_relaxed);
+					throw;
+				}
+
+				_state.store(state_ready, std::memory_order_release);
+#if defined(__cpp_lib_atomic_wait)
+				_state.notify_all();
+#endif
+				return true;
+			}
+
+			void wait_ready() const
+			{
+#if defined(__cpp_lib_atomic_wait)
+				for (int state = _state.load(std::memory_order_acquire); state != state_ready; state = _state.load(std::memory_order_acquire))
+					_state.wait(state, std::memory_order_acquire);
+#else
+				detail::backoff delay;
+				while (not this->ready())
+					delay.pause();
+#endif
+			}
+
+		public:
+			atomic_expected() noexcept : _state(state_empty)
+			{
+			}
+
+			atomic_expected(const atomic_expected&) = delete;
+			atomic_expected& operator=(const atomic_expected&) = delete;
+
+			~atomic_expected()
+			{
+				if (_state.load(std::memory_order_acquire) == state_ready)
+					_result.~expected();
+			}
+
+			bool set_value(const T& value)
+			{
+				return this->publish(value);
+			}
+
+			bool set_value(T&& value)
+			{
+				return this->publish(std::move(value));
+			}
+
+			bool set_error(const E& error)
+			{
+				return this->publish(error);
+			}
+
+			bool set_error(E&& error)
+			{
+				return this->publish(std::move(error));
+			}
+
+			bool set(expected<T, E>&& result)
+			{
+				return this->publish(std::move(result));
+			}
+
+			bool set(const expected<T, E>& result)
+			{
+				return this->publish(result);
+			}
+
+			bool ready() const noexcept
+			{
+				return _state.load(std::memory_order_acquire) == state_ready;
+			}
+
+			const expected<T, E>* try_get() const noexcept
+			{
+				if (not this->ready())
+					return nullptr;
+				return std::addressof(_result);
+			}
+
+			const expected<T, E>& wait() const&
+			{
+				this->wait_ready();
+				return _result;
+			}
+
+			expected<T, E> wait() &&
+			{
+				return this->take();
+			}
+
+			// waits and moves the result out, for a single consumer of a move-only or expensive
+			// payload; other readers see the moved-from result afterwards
+			expected<T, E> take()
+			{
+				this->wait_ready();
+				return std::move(_result);
+			}
+	};
+
+#if defined(_source_location)
+	}
+#endif
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <expected/error_pool.hpp>
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	template<class E>
+	class boxed {
+		private:
+			E* _error;
+
+			static_assert(alignof(E) <= alignof(std::max_align_t), "over-aligned errors cannot be boxed");
+
+			template<class... Args>
+			static E* create(Args&&... args)
+			{
+				void* memory = detail::error_pool::allocate(sizeof(E));
+				try
+				{
+					return new (memory) E(std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					detail::error_pool::deallocate(memory);
+					throw;
+				}
+			}
+
+			static void destroy(E* error) noexcept
+			{
+				error->~E();
+				detail::error_pool::deallocate(error);
+			}
+
+		public:
+			using element_type = E;
+
+			boxed(const E& error) : _error(create(error))
+			{
+			}
+
+			boxed(E&& error) : _error(create(std::move(error)))
+			{
+			}
+
+			boxed(const boxed& other) : _error(other._error != nullptr ? create(*other._error) : nullptr)
+			{
+			}
+
+			boxed(boxed&& other) noexcept : _error(other._error)
+			{
+				other._error = nullptr;
+			}
+
+			boxed& operator=(const boxed& other)
+			{
+				boxed copy(other);
+				std::swap(_error, copy._error);
+				return *this;
+			}
+
+			boxed& operator=(boxed&& other) noexcept
+			{
+				if (this != &other)
+				{
+					if (_error != nullptr)
+						destroy(_error);
+					_error	     = other._error;
+					other._error = nullptr;
+				}
+				return *this;
+			}
+
+			~boxed()
+			{
+				if (_error != nullptr)
+					destroy(_error);
+			}
+
+			const E& get() const noexcept
+			{
+				return *_error;
+			}
+
+			E& get() noexcept
+			{
+				return *_error;
+			}
+
+			const E& operator*() const noexcept
+			{
+				return *_error;
+			}
+
+			E& operator*() noexcept
+			{
+				return *_error;
+			}
+
+			const E* operator->() const noexcept
+			{
+				return _error;
+			}
+
+			E* operator->() noexcept
+			{
+				return _error;
+			}
+
+			// a moved-from box holds nothing; two empty boxes are equal and an empty box differs
+			// from any full one
+			friend bool operator==(const boxed& lhs, const boxed& rhs)
+			{
+				if (lhs._error == nullptr || rhs._error == nullptr)
+					return lhs._error == rhs._error;
+				return *lhs._error == *rhs._error;
+			}
+
+			friend bool operator!=(const boxed& lhs, const boxed& rhs)
+			{
+				return not(lhs == rhs);
+			}
+	};
+
+	namespace detail {
+		template<class E>
+		struct is_error_wrapper<boxed<E>> : std::true_type {};
+	}
+
+	template<class E, std::size_t Threshold = 4 * sizeof(void*)>
+	using boxed_if_large = typename std::conditional<(sizeof(E) > Threshold), boxed<E>, E>::type;
+
+#if defined(_source_location)
+	}
+#endif
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <expected/detail/error_message.hpp>
+#include <expected/error_pool.hpp>
+#include <expected/format_error.hpp>
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	struct context_frame {
+			const char*  format;
+			std::int64_t argument;
+	};
+
+	template<class E, std::size_t N = 4>
+	class context_error {
+		private:
+			static_assert(N > 0, "context_error needs room for at least one inline frame");
+
+			E	       _error;
+			std::uint32_t  _size;
+			std::uint32_t  _capacity;
+			context_frame  _frames[N];
+			context_frame* _spill;
+
+			void grow()
+			{
+				std::uint32_t  capacity = _capacity == 0 ? static_cast<std::uint32_t>(N) : _capacity * 2;
+				context_frame* spill	= static_cast<context_frame*>(detail::error_pool::allocate(capacity * sizeof(context_frame)));
+				if (_spill != nullptr)
+				{
+					std::memcpy(spill, _spill, _capacity * sizeof(context_frame));
+					detail::error_pool::deallocate(_spill);
+				}
+				_spill	  = spill;
+				_capacity = capacity;
+			}
+
+			void release() noexcept
+			{
+				if (_spill != nullptr)
+					detail::error_pool::deallocate(_spill);
+				_spill	  = nullptr;
+				_capacity = 0;
+			}
+
+		public:
+			using element_type = E;
+
+			context_error(const E& error) : _error(error), _size(0), _capacity(0), _spill(nullptr)
+			{
+			}
+
+			context_error(E&& error) : _error(std::move(error)), _size(0), _capacity(0), _spill(nullptr)
+			{
+			}
+
+			context_error(const context_error& other) : _error(other._error), _size(other._size), _capacity(0), _spill(nullptr)
+			{
+				std::memcpy(_frames, other._frames, (_size < N ? _size : N) * sizeof(context_frame));
+				if (_size > N)
+				{
+					_capacity = _size - static_cast<std::uint32_t>(N);
+					_spill	  = static_cast<context_frame*>(detail::error_pool::allocate(_capacity * sizeof(context_frame)));
+					std::memcpy(_spill, other._spill, _capacity * sizeof(context_frame));
+				}
+			}
+
+			context_error(context_error&& other) noexcept(std::is_nothrow_move_constructible<E>::value)
+			    : _error(std::move(other._error)), _size(other._size), _capacity(other._capacity), _spill(other._spill)
+			{
+				std::memcpy(_frames, other._frames, (_size < N ? _size : N) * sizeof(context_frame));
+				other._size	= 0;
+				other._capacity = 0;
+				other._spill	= nullptr;
+			}
+
+			context_error& operator=(const context_error& other)
+			{
+				if (this != &other)
+				{
+					context_error copy(other);
+					*this = std::move(copy);
+				}
+				return *this;
+			}
+
+			context_error& operator=(context_error&& other) noexcept(std::is_nothrow_move_assignable<E>::value)
+			{
+				if (this != &other)
+				{
+					_error = std::move(other._error);
+					this->release();
+					_size	  = other._size;
+					_capacity = other._capacity;
+					_spill	  = other._spill;
+					std::memcpy(_frames, other._frames, (_size < N ? _size : N) * sizeof(context_frame));
+					other._size	= 0;
+					other._capacity = 0;
+					other._spill	= nullptr;
+				}
+				return *this;
+			}
+
+			~context_error()
+			{
+				this->release();
+			}
+
+			void add_context(const char* format, std::int64_t argument = 0)
+			{
+				context_frame frame = {format, argument};
+				if (_size < N)
+				{
+					_frames[_size] = frame;
+				}
+				else
+				{
+					if (_size - N == _capacity)
+						this->grow();
+					_spill[_size - N] = frame;
+				}
+				_size++;
+			}
+
+			const E& root() const noexcept
+			{
+				return _error;
+			}
+
+			std::size_t depth() const noexcept
+			{
+				return _size;
+			}
+
+			const context_frame& frame(std::size_t index) const noexcept
+			{
+				return index < N ? _frames[index] : _spill[index - N];
+			}
+
+			std::string message() const
+			{
+				std::string out;
+				for (std::size_t i = _size; i-- > 0;)
+				{
+					const context_frame& current = this->frame(i);
+					const char*	     rest    = detail::append_literal(out, current.format);
+					if (rest != nullptr)
+					{
+						detail::append_argument(out, current.argument);
+						detail::packed_arguments<>().render(out, rest);
+					}
+					out += ": ";
+				}
+				out += detail::error_message(_error, detail::priority<4>());
+				return out;
+			}
+	};
+
+	namespace detail {
+		template<class E, std::size_t N>
+		struct is_error_wrapper<context_error<E, N>> : std::true_type {};
+	}
+
+#if defined(_source_location)
+	}
+#endif
+}
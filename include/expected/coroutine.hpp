@@ -0,0 +1,476 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <exception>
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#endif
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+#if defined(__cpp_impl_coroutine)
+	template<class T, class E>
+	class expected_task;
+
+	namespace detail {
+		template<class Result, class Promise>
+		class expected_awaiter {
+			private:
+				Result	 _result;
+				Promise& _promise;
+
+			public:
+				expected_awaiter(Result&& result, Promise& promise) : _result(std::forward<Result>(result)), _promise(promise)
+				{
+				}
+
+				bool await_ready() const noexcept
+				{
+					return _result.has_value();
+				}
+
+				void await_suspend(std::coroutine_handle<>)
+				{
+					_promise.set_error(std::forward<Result>(_result).error() _location_with(_result.error_location()));
+				}
+
+				decltype(auto) await_resume()
+				{
+					if constexpr (std::is_lvalue_reference<Result>::value)
+						return *_result;
+					else
+						return typename std::remove_reference<Result>::type::value_type(*std::move(_result));
+				}
+		};
+	}
+
+	template<class T, class E>
+	class expected_task {
+		public:
+			class promise_type {
+				private:
+					bool		   _has_result = false;
+					std::exception_ptr _exception;
+
+					union {
+							expected<T, E> _result;
+					};
+
+				public:
+					promise_type() noexcept
+					{
+					}
+
+					~promise_type()
+					{
+						if (_has_result)
+							_result.~expected();
+					}
+
+					expected_task get_return_object() noexcept
+					{
+						return expected_task(std::coroutine_handle<promise_type>::from_promise(*this));
+					}
+
+					std::suspend_never initial_suspend() const noexcept
+					{
+						return {};
+					}
+
+					std::suspend_always final_suspend() const noexcept
+					{
+						return {};
+					}
+
+					void return_value(expected<T, E>&& result)
+					{
+						std::construct_at(std::addressof(_result), std::move(result));
+						_has_result = true;
+					}
+
+					template<class G>
+					void set_error(G&& error _location_param)
+					{
+						std::construct_at(std::addressof(_result), E(std::forward<G>(error)) _location_arg);
+						_has_result = true;
+					}
+
+					void unhandled_exception() noexcept
+					{
+						_exception = std::current_exception();
+					}
+
+					template<class U, class G>
+					detail::expected_awaiter<expected<U, G>&, promise_type> await_transform(expected<U, G>& result) noexcept
+					{
+						return {result, *this};
+					}
+
+					template<class U, class G>
+					detail::expected_awaiter<const expected<U, G>&, promise_type> await_transform(const expected<U, G>& result) noexcept
+					{
+						return {result, *this};
+					}
+
+					template<class U, class G>
+					detail::expected_awaiter<expected<U, G>&&, promise_type> await_transform(expected<U, G>&& result) noexcept
+					{
+						return {std::move(result), *this};
+					}
+
+					template<class U, class G>
+					detail::expected_awaiter<expected<U, G>, promise_type> await_transform(expected_task<U, G>&& task)
+					{
+						return {std::move(task).get(), *this};
+					}
+
+					expected<T, E> take()
+					{
+						if (_exception)
+							std::rethrow_exception(_exception);
+						return std::move(_result);
+					}
+			};
+
+		private:
+			std::coroutine_handle<promise_type> _handle;
+
+			explicit expected_task(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle)
+			{
+			}
+
+		public:
+			expected_task(const expected_task&) = delete;
+			expected_task& operator=(const expected_task&) = delete;
+
+			expected_task(expected_task&& other) noexcept : _handle(std::exchange(other._handle, nullptr))
+			{
+			}
+
+			expected_task& operator=(expected_task&& other) noexcept
+			{
+				if (this != &other)
+				{
+					if (_handle)
+						_handle.destroy();
+					_handle = std::exchange(other._handle, nullptr);
+				}
+				return *this;
+			}
+
+			~expected_task()
+			{
+				if (_handle)
+					_handle.destroy();
+			}
+
+			expected<T, E> get() &&
+			{
+				if (not _handle)
+				{
+					throw std::runtime_error("Attempted to get the result of an empty task");
+				}
+				return _handle.promise().take();
+			}
+
+			operator expected<T, E>() &&
+			{
+				return std::move(*this).get();
+			}
+	};
+#endif
+
+#if defined(__cpp_impl_coroutine)
+	namespace detail {
+		struct alignas(std::max_align_t) frame_block {
+				unsigned char bytes[alignof(std::max_align_t)];
+		};
+
+		using frame_deallocate = void (*)(void*, std::size_t);
+
+		constexpr std::size_t align_up(std::size_t size, std::size_t alignment) noexcept
+		{
+			return (size + alignment - 1) / alignment * alignment;
+		}
+
+		template<class Alloc>
+		class frame_allocator {
+			private:
+				using block_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<frame_block>;
+				using traits	      = std::allocator_traits<block_allocator>;
+
+				static constexpr std::size_t deallocate_offset(std::size_t size) noexcept
+				{
+					return align_up(size, alignof(frame_deallocate));
+				}
+
+				static constexpr std::size_t allocator_offset(std::size_t size) noexcept
+				{
+					return align_up(deallocate_offset(size) + sizeof(frame_deallocate), alignof(block_allocator));
+				}
+
+				static constexpr std::size_t blocks(std::size_t size) noexcept
+				{
+					return (allocator_offset(size) + sizeof(block_allocator) + sizeof(frame_block) - 1) / sizeof(frame_block);
+				}
+
+			public:
+				static void* allocate(const Alloc& alloc, std::size_t size)
+				{
+					block_allocator allocator(alloc);
+					unsigned char*	frame = reinterpret_cast<unsigned char*>(traits::allocate(allocator, blocks(size)));
+					frame_deallocate deallocate = &frame_allocator::deallocate;
+					std::memcpy(frame + deallocate_offset(size), &deallocate, sizeof(deallocate));
+					new (frame + allocator_offset(size)) block_allocator(std::move(allocator));
+					return frame;
+				}
+
+				static void deallocate(void* pointer, std::size_t size) noexcept
+				{
+					unsigned char*	 frame	   = static_cast<unsigned char*>(pointer);
+					block_allocator* stored	   = std::launder(reinterpret_cast<block_allocator*>(frame + allocator_offset(size)));
+					block_allocator	 allocator = std::move(*stored);
+					stored->~block_allocator();
+					traits::deallocate(allocator, reinterpret_cast<frame_block*>(frame), blocks(size));
+				}
+
+				static void release(void* pointer, std::size_t size) noexcept
+				{
+					frame_deallocate deallocate;
+					std::memcpy(&deallocate, static_cast<unsigned char*>(pointer) + deallocate_offset(size), sizeof(deallocate));
+					deallocate(pointer, size);
+				}
+		};
+	}
+
+	template<class T, class E>
+	class expected_generator {
+		public:
+			class promise_type {
+				private:
+					expected<T, E>*	   _current	  = nullptr;
+					bool		   _stop_on_error = false;
+					bool		   _stopped	  = false;
+					bool		   _has_copy	  = false;
+					std::exception_ptr _exception;
+
+					union {
+							expected<T, E> _copy;
+					};
+
+					void drop_copy() noexcept
+					{
+						if (_has_copy)
+						{
+							_copy.~expected();
+							_has_copy = false;
+						}
+					}
+
+					friend class expected_generator;
+
+				public:
+					promise_type() noexcept
+					{
+					}
+
+					~promise_type()
+					{
+						this->drop_copy();
+					}
+
+					static void* operator new(std::size_t size)
+					{
+						return detail::frame_allocator<std::allocator<char>>::allocate(std::allocator<char>(), size);
+					}
+
+					template<class Alloc, class... Args>
+					static void* operator new(std::size_t size, std::allocator_arg_t, const Alloc& alloc, const Args&...)
+					{
+						return detail::frame_allocator<Alloc>::allocate(alloc, size);
+					}
+
+					template<class This, class Alloc, class... Args>
+					static void* operator new(std::size_t size, const This&, std::allocator_arg_t, const Alloc& alloc, const Args&...)
+					{
+						return detail::frame_allocator<Alloc>::allocate(alloc, size);
+					}
+
+					static void operator delete(void* pointer, std::size_t size) noexcept
+					{
+						detail::frame_allocator<std::allocator<char>>::release(pointer, size);
+					}
+
+					expected_generator get_return_object() noexcept
+					{
+						return expected_generator(std::coroutine_handle<promise_type>::from_promise(*this));
+					}
+
+					std::suspend_always initial_suspend() const noexcept
+					{
+						return {};
+					}
+
+					std::suspend_always final_suspend() const noexcept
+					{
+						return {};
+					}
+
+					std::suspend_always yield_value(expected<T, E>&& result) noexcept
+					{
+						this->drop_copy();
+						_current = std::addressof(result);
+						return {};
+					}
+
+					std::suspend_always yield_value(const expected<T, E>& result)
+					{
+						this->drop_copy();
+						std::construct_at(std::addressof(_copy), result);
+						_has_copy = true;
+						_current  = std::addressof(_copy);
+						return {};
+					}
+
+					void return_void() const noexcept
+					{
+					}
+
+					void unhandled_exception() noexcept
+					{
+						_exception = std::current_exception();
+					}
+
+					template<class U>
+					void await_transform(U&&) = delete;
+			};
+
+			class iterator {
+				private:
+					std::coroutine_handle<promise_type> _handle;
+
+					void resume() const
+					{
+						promise_type& promise = _handle.promise();
+						if (promise._stop_on_error && promise._current != nullptr && not promise._current->has_value())
+						{
+							promise._stopped = true;
+							return;
+						}
+						_handle.resume();
+						if (promise._exception)
+							std::rethrow_exception(std::exchange(promise._exception, nullptr));
+					}
+
+					bool finished() const noexcept
+					{
+						return _handle.done() || _handle.promise()._stopped;
+					}
+
+					friend class expected_generator;
+
+					explicit iterator(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle)
+					{
+					}
+
+				public:
+					using value_type      = expected<T, E>;
+					using difference_type = std::ptrdiff_t;
+					using reference	      = expected<T, E>&;
+
+					iterator() noexcept = default;
+
+					reference operator*() const noexcept
+					{
+						return *_handle.promise()._current;
+					}
+
+					iterator& operator++()
+					{
+						this->resume();
+						return *this;
+					}
+
+					void operator++(int)
+					{
+						++*this;
+					}
+
+					friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept
+					{
+						return it.finished();
+					}
+			};
+
+		private:
+			std::coroutine_handle<promise_type> _handle;
+
+			explicit expected_generator(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle)
+			{
+			}
+
+		public:
+			expected_generator(const expected_generator&) = delete;
+			expected_generator& operator=(const expected_generator&) = delete;
+
+			expected_generator(expected_generator&& other) noexcept : _handle(std::exchange(other._handle, nullptr))
+			{
+			}
+
+			expected_generator& operator=(expected_generator&& other) noexcept
+			{
+				if (this != &other)
+				{
+					if (_handle)
+						_handle.destroy();
+					_handle = std::exchange(other._handle, nullptr);
+				}
+				return *this;
+			}
+
+			~expected_generator()
+			{
+				if (_handle)
+					_handle.destroy();
+			}
+
+			expected_generator& stop_on_error(bool enabled = true) & noexcept
+			{
+				_handle.promise()._stop_on_error = enabled;
+				return *this;
+			}
+
+			expected_generator stop_on_error(bool enabled = true) && noexcept
+			{
+				_handle.promise()._stop_on_error = enabled;
+				return std::move(*this);
+			}
+
+			iterator begin()
+			{
+				iterator it(_handle);
+				it.resume();
+				return it;
+			}
+
+			std::default_sentinel_t end() const noexcept
+			{
+				return std::default_sentinel;
+			}
+	};
+#endif
+
+#if defined(_source_location)
+	}
+#endif
+}
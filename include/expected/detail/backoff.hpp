@@ -0,0 +1,38 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <chrono>
+#include <thread>
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	namespace detail {
+		class backoff {
+			private:
+				unsigned _step = 0;
+
+			public:
+				void pause()
+				{
+					if (_step < 64)
+						std::this_thread::yield();
+					else
+						std::this_thread::sleep_for(std::chrono::microseconds(50));
+					_step++;
+				}
+		};
+	}
+
+#if defined(_source_location)
+	}
+#endif
+}
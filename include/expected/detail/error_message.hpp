@@ -0,0 +1,80 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <string>
+#include <system_error>
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	namespace detail {
+		template<int N>
+		struct priority : priority<N - 1> {};
+
+		template<>
+		struct priority<0> {};
+
+		template<class E, typename std::enable_if<std::is_error_code_enum<E>::value, int>::type = 0>
+		std::string error_message(const E& error, priority<4>)
+		{
+			using std::make_error_code;
+			return make_error_code(error).message();
+		}
+
+		template<class E,
+		    typename std::enable_if<std::is_error_condition_enum<E>::value && not std::is_error_code_enum<E>::value, int>::type = 0>
+		std::string error_message(const E& error, priority<4>)
+		{
+			using std::make_error_condition;
+			return make_error_condition(error).message();
+		}
+
+		template<class E>
+		auto error_message(const E& error, priority<3>) -> decltype(std::string(error.message()))
+		{
+			return std::string(error.message());
+		}
+
+		template<class E>
+		auto error_message(const E& error, priority<2>) -> decltype(std::string(error.what()))
+		{
+			return std::string(error.what());
+		}
+
+		template<class E>
+		auto error_message(const E& error, priority<1>) -> decltype(std::string(error))
+		{
+			return std::string(error);
+		}
+
+		template<class E>
+		std::string error_message(const E&, priority<0>)
+		{
+			return "unknown error";
+		}
+
+		template<class E>
+		auto error_equal(const E& lhs, const E& rhs, priority<1>) -> decltype(bool(lhs == rhs))
+		{
+			return bool(lhs == rhs);
+		}
+
+		template<class E>
+		bool error_equal(const E& lhs, const E& rhs, priority<0>) noexcept
+		{
+			return std::addressof(lhs) == std::addressof(rhs);
+		}
+	}
+
+#if defined(_source_location)
+	}
+#endif
+}
@@ -0,0 +1,246 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <expected/detail/error_message.hpp>
+#include <expected/error_pool.hpp>
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	namespace detail {
+		struct erased_error_vtable {
+				std::string (*message)(const void*);
+				bool (*equal)(const void*, const void*);
+				const void* (*get)(const void*);
+				void (*clone)(const void*, void*);
+				void (*move)(void*, void*);
+				void (*destroy)(void*);
+		};
+
+		constexpr std::size_t erased_error_buffer = 32;
+
+		template<class E, bool Inline = sizeof(E) <= erased_error_buffer && alignof(E) <= alignof(void*)
+						&& std::is_nothrow_move_constructible<E>::value>
+		struct erased_storage {
+				static const E* get(const void* storage) noexcept
+				{
+					return static_cast<const E*>(storage);
+				}
+
+				template<class... Args>
+				static void create(void* storage, Args&&... args)
+				{
+					new (storage) E(std::forward<Args>(args)...);
+				}
+
+				static void move(void* from, void* to) noexcept
+				{
+					E* source = static_cast<E*>(from);
+					new (to) E(std::move(*source));
+					source->~E();
+				}
+
+				static void destroy(void* storage) noexcept
+				{
+					static_cast<E*>(storage)->~E();
+				}
+		};
+
+		template<class E>
+		struct erased_storage<E, false> {
+				static_assert(alignof(E) <= alignof(std::max_align_t), "over-aligned errors cannot be erased");
+
+				static const E* get(const void* storage) noexcept
+				{
+					return *static_cast<E* const*>(storage);
+				}
+
+				template<class... Args>
+				static void create(void* storage, Args&&... args)
+				{
+					void* memory = error_pool::allocate(sizeof(E));
+					try
+					{
+						new (storage) E*(new (memory) E(std::forward<Args>(args)...));
+					}
+					catch (...)
+					{
+						error_pool::deallocate(memory);
+						throw;
+					}
+				}
+
+				static void move(void* from, void* to) noexcept
+				{
+					new (to) E*(*static_cast<E**>(from));
+				}
+
+				static void destroy(void* storage) noexcept
+				{
+					E* error = *static_cast<E**>(storage);
+					error->~E();
+					error_pool::deallocate(error);
+				}
+		};
+
+		template<class E>
+		struct erased_error_table {
+				static std::string message(const void* storage)
+				{
+					return error_message(*erased_storage<E>::get(storage), priority<4>());
+				}
+
+				static bool equal(const void* lhs, const void* rhs)
+				{
+					return error_equal(*erased_storage<E>::get(lhs), *erased_storage<E>::get(rhs), priority<1>());
+				}
+
+				static const void* get(const void* storage) noexcept
+				{
+					return erased_storage<E>::get(storage);
+				}
+
+				static void clone(const void* from, void* to)
+				{
+					erased_storage<E>::create(to, *erased_storage<E>::get(from));
+				}
+
+				static const erased_error_vtable table;
+		};
+
+		template<class E>
+		const erased_error_vtable erased_error_table<E>::table = {&erased_error_table<E>::message, &erased_error_table<E>::equal,
+		    &erased_error_table<E>::get, &erased_error_table<E>::clone, &erased_storage<E>::move, &erased_storage<E>::destroy};
+	}
+
+	class erased_error {
+		private:
+			const detail::erased_error_vtable* _vtable;
+			alignas(void*) unsigned char	   _storage[detail::erased_error_buffer];
+
+			void take(erased_error& other) noexcept
+			{
+				_vtable = other._vtable;
+				if (_vtable != nullptr)
+				{
+					_vtable->move(other._storage, _storage);
+					other._vtable = nullptr;
+				}
+			}
+
+		public:
+			erased_error() noexcept : _vtable(nullptr)
+			{
+			}
+
+			// explicit so that arbitrary values never turn into errors silently, and so that
+			// expected<T, erased_error> built from something convertible to T is not ambiguous;
+			// errors enter an expected through nl::unexpected
+			template<class E, class D = typename std::decay<E>::type,
+			    class = typename std::enable_if<not std::is_same<D, erased_error>::value>::type>
+			explicit erased_error(E&& error) : _vtable(&detail::erased_error_table<D>::table)
+			{
+				detail::erased_storage<D>::create(_storage, std::forward<E>(error));
+			}
+
+			erased_error(const erased_error& other) : _vtable(other._vtable)
+			{
+				if (_vtable != nullptr)
+					_vtable->clone(other._storage, _storage);
+			}
+
+			erased_error(erased_error&& other) noexcept
+			{
+				this->take(other);
+			}
+
+			erased_error& operator=(const erased_error& other)
+			{
+				if (this != &other)
+				{
+					erased_error copy(other);
+					this->reset();
+					this->take(copy);
+				}
+				return *this;
+			}
+
+			erased_error& operator=(erased_error&& other) noexcept
+			{
+				if (this != &other)
+				{
+					this->reset();
+					this->take(other);
+				}
+				return *this;
+			}
+
+			~erased_error()
+			{
+				this->reset();
+			}
+
+			void reset() noexcept
+			{
+				if (_vtable != nullptr)
+				{
+					_vtable->destroy(_storage);
+					_vtable = nullptr;
+				}
+			}
+
+			bool empty() const noexcept
+			{
+				return _vtable == nullptr;
+			}
+
+			std::string message() const
+			{
+				return _vtable != nullptr ? _vtable->message(_storage) : std::string();
+			}
+
+			const void* domain() const noexcept
+			{
+				return _vtable;
+			}
+
+			template<class E>
+			bool is() const noexcept
+			{
+				return _vtable == &detail::erased_error_table<E>::table;
+			}
+
+			template<class E>
+			const E* get_if() const noexcept
+			{
+				return this->is<E>() ? static_cast<const E*>(_vtable->get(_storage)) : nullptr;
+			}
+
+			friend bool operator==(const erased_error& lhs, const erased_error& rhs)
+			{
+				return lhs._vtable == rhs._vtable && (lhs._vtable == nullptr || lhs._vtable->equal(lhs._storage, rhs._storage));
+			}
+
+			friend bool operator!=(const erased_error& lhs, const erased_error& rhs)
+			{
+				return not(lhs == rhs);
+			}
+	};
+
+	namespace detail {
+		template<class G>
+		struct accepts_error<erased_error, G> : std::integral_constant<bool, not std::is_same<G, erased_error>::value> {};
+	}
+
+#if defined(_source_location)
+	}
+#endif
+}
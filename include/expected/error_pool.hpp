@@ -0,0 +1,283 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	struct error_pool_stats {
+			std::size_t hits;
+			std::size_t misses;
+			std::size_t remote_frees;
+	};
+
+	namespace detail {
+		class error_cache;
+
+		struct alignas(std::max_align_t) pool_header {
+				error_cache*  owner;
+				std::uint32_t size_class;
+		};
+
+		class error_cache {
+			public:
+				static constexpr std::size_t classes	= 6;
+				static constexpr std::size_t max_cached = 4096;
+
+			private:
+				pool_header*		  _free[classes];
+				std::size_t		  _cached[classes];
+				std::atomic<pool_header*> _remote;
+				std::atomic<bool>	  _in_use;
+				error_cache*		  _next;
+				std::atomic<std::size_t>  _hits;
+				std::atomic<std::size_t>  _misses;
+				std::atomic<std::size_t>  _remote_frees;
+
+				static std::atomic<error_cache*>& registry() noexcept
+				{
+					static std::atomic<error_cache*> head(nullptr);
+					return head;
+				}
+
+				static pool_header* linked(pool_header* header) noexcept
+				{
+					pool_header* next;
+					std::memcpy(&next, header + 1, sizeof(next));
+					return next;
+				}
+
+				static void link(pool_header* header, pool_header* next) noexcept
+				{
+					std::memcpy(header + 1, &next, sizeof(next));
+				}
+
+				static void bump(std::atomic<std::size_t>& counter) noexcept
+				{
+					counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+				}
+
+				void push_local(pool_header* header) noexcept
+				{
+					std::uint32_t size_class = header->size_class;
+					if (_cached[size_class] >= max_cached)
+					{
+						::operator delete(header);
+						return;
+					}
+					link(header, _free[size_class]);
+					_free[size_class] = header;
+					_cached[size_class]++;
+				}
+
+				void drain() noexcept
+				{
+					if (_remote.load(std::memory_order_relaxed) == nullptr)
+						return;
+					pool_header* header = _remote.exchange(nullptr, std::memory_order_acquire);
+					while (header != nullptr)
+					{
+						pool_header* next = linked(header);
+						this->push_local(header);
+						header = next;
+					}
+				}
+
+				error_cache() : _remote(nullptr), _in_use(true), _next(nullptr), _hits(0), _misses(0), _remote_frees(0)
+				{
+					for (std::size_t i = 0; i < classes; i++)
+					{
+						_free[i]   = nullptr;
+						_cached[i] = 0;
+					}
+				}
+
+			public:
+				static constexpr std::size_t class_size(std::size_t size_class) noexcept
+				{
+					return std::size_t(32) << size_class;
+				}
+
+				static std::size_t class_of(std::size_t size) noexcept
+				{
+					std::size_t size_class = 0;
+					while (size_class < classes && class_size(size_class) < size)
+						size_class++;
+					return size_class;
+				}
+
+				static error_cache* acquire()
+				{
+					std::atomic<error_cache*>& head = registry();
+					for (error_cache* cache = head.load(std::memory_order_acquire); cache != nullptr; cache = cache->_next)
+					{
+						bool in_use = false;
+						if (cache->_in_use.compare_exchange_strong(in_use, true, std::memory_order_acquire, std::memory_order_relaxed))
+							return cache;
+					}
+
+					error_cache* cache = new error_cache();
+					cache->_next	   = head.load(std::memory_order_relaxed);
+					while (not head.compare_exchange_weak(cache->_next, cache, std::memory_order_release, std::memory_order_relaxed))
+					{
+					}
+					return cache;
+				}
+
+				void abandon() noexcept
+				{
+					_in_use.store(false, std::memory_order_release);
+				}
+
+				void* allocate(std::size_t size_class)
+				{
+					pool_header* header = _free[size_class];
+					if (header == nullptr)
+					{
+						this->drain();
+						header = _free[size_class];
+					}
+
+					if (header != nullptr)
+					{
+						_free[size_class] = linked(header);
+						_cached[size_class]--;
+						bump(_hits);
+						return header + 1;
+					}
+
+					bump(_misses);
+					header		   = static_cast<pool_header*>(::operator new(sizeof(pool_header) + class_size(size_class)));
+					header->owner	   = this;
+					header->size_class = static_cast<std::uint32_t>(size_class);
+					return header + 1;
+				}
+
+				void deallocate(pool_header* header, bool local) noexcept
+				{
+					if (local)
+					{
+						this->push_local(header);
+						return;
+					}
+
+					pool_header* top = _remote.load(std::memory_order_relaxed);
+					do
+						link(header, top);
+					while (not _remote.compare_exchange_weak(top, header, std::memory_order_release, std::memory_order_relaxed));
+					_remote_frees.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				static error_pool_stats stats() noexcept
+				{
+					error_pool_stats total = {0, 0, 0};
+					for (error_cache* cache = registry().load(std::memory_order_acquire); cache != nullptr; cache = cache->_next)
+					{
+						total.hits	   += cache->_hits.load(std::memory_order_relaxed);
+						total.misses	   += cache->_misses.load(std::memory_order_relaxed);
+						total.remote_frees += cache->_remote_frees.load(std::memory_order_relaxed);
+					}
+					return total;
+				}
+		};
+
+		struct error_cache_slot {
+				error_cache* cache;
+				bool	     retired;
+
+				static error_cache_slot& local() noexcept
+				{
+					static thread_local error_cache_slot slot = {nullptr, false};
+					return slot;
+				}
+		};
+
+		// the owner and the pool are templates so the thread_local owner is only instantiated by code that
+		// boxes an error; GCC 12 cannot stream it into a module interface from a non-template function
+		template<class Tag>
+		struct error_cache_owner {
+				bool claimed = false;
+
+				static error_cache_owner& local() noexcept
+				{
+					static thread_local error_cache_owner owner;
+					return owner;
+				}
+
+				error_cache* claim()
+				{
+					error_cache_slot& slot = error_cache_slot::local();
+					slot.cache	       = error_cache::acquire();
+					claimed		       = true;
+					return slot.cache;
+				}
+
+				~error_cache_owner()
+				{
+					if (not claimed)
+						return;
+
+					error_cache_slot& slot = error_cache_slot::local();
+					error_cache*	  cache = slot.cache;
+					slot.cache		= nullptr;
+					slot.retired		= true;
+					cache->abandon();
+				}
+		};
+
+		template<class Tag = void>
+		struct basic_error_pool {
+				static error_cache* local()
+				{
+					error_cache_slot& slot = error_cache_slot::local();
+					if (slot.cache == nullptr && not slot.retired)
+						return error_cache_owner<Tag>::local().claim();
+					return slot.cache;
+				}
+
+				static void* allocate(std::size_t size)
+				{
+					std::size_t  size_class = error_cache::class_of(size);
+					error_cache* cache	= size_class < error_cache::classes ? local() : nullptr;
+					if (cache != nullptr)
+						return cache->allocate(size_class);
+
+					pool_header* header = static_cast<pool_header*>(::operator new(sizeof(pool_header) + size));
+					header->owner	    = nullptr;
+					header->size_class  = static_cast<std::uint32_t>(error_cache::classes);
+					return header + 1;
+				}
+
+				static void deallocate(void* memory) noexcept
+				{
+					pool_header* header = static_cast<pool_header*>(memory) - 1;
+					if (header->owner == nullptr)
+						::operator delete(header);
+					else
+						header->owner->deallocate(header, header->owner == error_cache_slot::local().cache);
+				}
+		};
+
+		using error_pool = basic_error_pool<>;
+	}
+
+	inline error_pool_stats error_pool_statistics() noexcept
+	{
+		return detail::error_cache::stats();
+	}
+
+#if defined(_source_location)
+	}
+#endif
+}
@@ -0,0 +1,467 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	namespace detail {
+		inline int countr_zero(std::uint64_t word) noexcept
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_ctzll(word);
+#else
+			int count = 0;
+			while ((word & 1) == 0)
+			{
+				word >>= 1;
+				count++;
+			}
+			return count;
+#endif
+		}
+
+		inline int popcount(std::uint64_t word) noexcept
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_popcountll(word);
+#else
+			int count = 0;
+			for (; word != 0; word &= word - 1)
+				count++;
+			return count;
+#endif
+		}
+	}
+
+	namespace detail {
+		template<class T>
+		struct vector_slot {
+				using type = T;
+
+				static T& get(T& slot) noexcept
+				{
+					return slot;
+				}
+
+				static const T& get(const T& slot) noexcept
+				{
+					return slot;
+				}
+		};
+
+		// std::vector<bool> has no bool& to hand out, so bools are kept a byte each like the
+		// parallel_transform buffer does
+		struct bool_slot {
+				bool value;
+
+				bool_slot() noexcept : value(false)
+				{
+				}
+
+				bool_slot(bool v) noexcept : value(v)
+				{
+				}
+		};
+
+		template<>
+		struct vector_slot<bool> {
+				using type = bool_slot;
+
+				static bool& get(bool_slot& slot) noexcept
+				{
+					return slot.value;
+				}
+
+				static const bool& get(const bool_slot& slot) noexcept
+				{
+					return slot.value;
+				}
+		};
+	}
+
+	template<class T, class E>
+	class expected_vector {
+		private:
+			std::vector<typename detail::vector_slot<T>::type> _values;
+			std::vector<std::uint64_t>	      _bitmap;
+			std::vector<std::pair<std::size_t, E>> _errors;
+
+			T& slot(std::size_t index) noexcept
+			{
+				return detail::vector_slot<T>::get(_values[index]);
+			}
+
+			const T& slot(std::size_t index) const noexcept
+			{
+				return detail::vector_slot<T>::get(_values[index]);
+			}
+
+			void push_bit(bool has_value)
+			{
+				std::size_t index = _values.size() - 1;
+				if (index % 64 == 0)
+					_bitmap.push_back(0);
+				if (has_value)
+					_bitmap[index / 64] |= std::uint64_t(1) << (index % 64);
+			}
+
+			template<class Owner, class Value, class Error>
+			class basic_reference {
+				private:
+					Owner*	    _owner;
+					std::size_t _index;
+
+				public:
+					basic_reference(Owner* owner, std::size_t index) : _owner(owner), _index(index)
+					{
+					}
+
+					std::size_t index() const noexcept
+					{
+						return _index;
+					}
+
+					bool has_value() const noexcept
+					{
+						return _owner->has_value(_index);
+					}
+
+					explicit operator bool() const noexcept
+					{
+						return this->has_value();
+					}
+
+					Value& value() const
+					{
+						if (not this->has_value())
+						{
+							throw std::runtime_error("Attempted to access the value of a error state");
+						}
+						return _owner->slot(_index);
+					}
+
+					Error& error() const
+					{
+						if (this->has_value())
+						{
+							throw std::runtime_error("Attempted to access the error of a value state");
+						}
+						return _owner->find_error(_index)->second;
+					}
+
+					template<class U = typename std::remove_cv<T>::type>
+					T value_or(U&& other) const
+					{
+						static_assert(std::is_convertible<U, T>::value, "the provided type must be convertible to the value type");
+						if (this->has_value())
+							return _owner->slot(_index);
+						else
+							return static_cast<T>(std::forward<U>(other));
+					}
+
+					expected<T, E> to_expected() const
+					{
+						if (this->has_value())
+							return expected<T, E>(_owner->slot(_index));
+						else
+							return expected<T, E>(_owner->find_error(_index)->second);
+					}
+			};
+
+			typename std::vector<std::pair<std::size_t, E>>::const_iterator find_error(std::size_t index) const
+			{
+				return std::lower_bound(_errors.begin(), _errors.end(), index,
+				    [](const std::pair<std::size_t, E>& entry, std::size_t i) { return entry.first < i; });
+			}
+
+			typename std::vector<std::pair<std::size_t, E>>::iterator find_error(std::size_t index)
+			{
+				return std::lower_bound(_errors.begin(), _errors.end(), index,
+				    [](const std::pair<std::size_t, E>& entry, std::size_t i) { return entry.first < i; });
+			}
+
+		public:
+			using value_type      = T;
+			using error_type      = E;
+			using size_type	      = std::size_t;
+			using reference	      = basic_reference<expected_vector, T, E>;
+			using const_reference = basic_reference<const expected_vector, const T, const E>;
+
+			class value_iterator {
+				private:
+					const expected_vector* _owner;
+					std::size_t	       _index;
+
+					void skip_errors()
+					{
+						std::size_t size = _owner->size();
+						while (_index < size)
+						{
+							std::uint64_t word = _owner->_bitmap[_index / 64] >> (_index % 64);
+							if (word != 0)
+							{
+								_index += static_cast<std::size_t>(detail::countr_zero(word));
+								break;
+							}
+							_index = (_index / 64 + 1) * 64;
+						}
+						if (_index > size)
+							_index = size;
+					}
+
+				public:
+					using iterator_category = std::forward_iterator_tag;
+					using value_type	= T;
+					using difference_type	= std::ptrdiff_t;
+					using pointer		= const T*;
+					using reference		= const T&;
+
+					value_iterator() : _owner(nullptr), _index(0)
+					{
+					}
+
+					value_iterator(const expected_vector* owner, std::size_t index) : _owner(owner), _index(index)
+					{
+						this->skip_errors();
+					}
+
+					std::size_t index() const noexcept
+					{
+						return _index;
+					}
+
+					const T& operator*() const
+					{
+						return _owner->slot(_index);
+					}
+
+					const T* operator->() const
+					{
+						return std::addressof(_owner->slot(_index));
+					}
+
+					value_iterator& operator++()
+					{
+						_index++;
+						this->skip_errors();
+						return *this;
+					}
+
+					value_iterator operator++(int)
+					{
+						value_iterator copy = *this;
+						++*this;
+						return copy;
+					}
+
+					bool operator==(const value_iterator& other) const noexcept
+					{
+						return _index == other._index;
+					}
+
+					bool operator!=(const value_iterator& other) const noexcept
+					{
+						return _index != other._index;
+					}
+			};
+
+			class value_range {
+				private:
+					const expected_vector* _owner;
+
+				public:
+					explicit value_range(const expected_vector* owner) : _owner(owner)
+					{
+					}
+
+					value_iterator begin() const
+					{
+						return value_iterator(_owner, 0);
+					}
+
+					value_iterator end() const
+					{
+						return value_iterator(_owner, _owner->size());
+					}
+			};
+
+			expected_vector()
+			{
+				static_assert(std::is_default_constructible<T>::value, "the value type must be default constructible");
+			}
+
+			std::size_t size() const noexcept
+			{
+				return _values.size();
+			}
+
+			bool empty() const noexcept
+			{
+				return _values.empty();
+			}
+
+			std::size_t error_count() const noexcept
+			{
+				return _errors.size();
+			}
+
+			void reserve(std::size_t capacity)
+			{
+				_values.reserve(capacity);
+				_bitmap.reserve((capacity + 63) / 64);
+			}
+
+			void clear() noexcept
+			{
+				_values.clear();
+				_bitmap.clear();
+				_errors.clear();
+			}
+
+			bool has_value(std::size_t index) const noexcept
+			{
+				return (_bitmap[index / 64] >> (index % 64)) & 1;
+			}
+
+			void push_back(const T& value)
+			{
+				this->emplace_back(value);
+			}
+
+			void push_back(T&& value)
+			{
+				this->emplace_back(std::move(value));
+			}
+
+			void push_back(const expected<T, E>& result)
+			{
+				if (result.has_value())
+					this->emplace_back(result.value());
+				else
+					this->emplace_error(result.error());
+			}
+
+			void push_back(expected<T, E>&& result)
+			{
+				if (result.has_value())
+					this->emplace_back(std::move(result).value());
+				else
+					this->emplace_error(std::move(result).error());
+			}
+
+			void push_error(const E& error)
+			{
+				this->emplace_error(error);
+			}
+
+			void push_error(E&& error)
+			{
+				this->emplace_error(std::move(error));
+			}
+
+			template<class... Args>
+			T& emplace_back(Args&&... args)
+			{
+				_values.emplace_back(std::forward<Args>(args)...);
+				try
+				{
+					this->push_bit(true);
+				}
+				catch (...)
+				{
+					_values.pop_back();
+					throw;
+				}
+				return detail::vector_slot<T>::get(_values.back());
+			}
+
+			template<class... Args>
+			E& emplace_error(Args&&... args)
+			{
+				_values.emplace_back();
+				try
+				{
+					_errors.emplace_back(std::piecewise_construct, std::forward_as_tuple(_values.size() - 1),
+					    std::forward_as_tuple(std::forward<Args>(args)...));
+				}
+				catch (...)
+				{
+					_values.pop_back();
+					throw;
+				}
+
+				try
+				{
+					this->push_bit(false);
+				}
+				catch (...)
+				{
+					_errors.pop_back();
+					_values.pop_back();
+					throw;
+				}
+				return _errors.back().second;
+			}
+
+			reference operator[](std::size_t index)
+			{
+				return reference(this, index);
+			}
+
+			const_reference operator[](std::size_t index) const
+			{
+				return const_reference(this, index);
+			}
+
+			reference at(std::size_t index)
+			{
+				if (index >= this->size())
+				{
+					throw std::out_of_range("expected_vector index out of range");
+				}
+				return reference(this, index);
+			}
+
+			const_reference at(std::size_t index) const
+			{
+				if (index >= this->size())
+				{
+					throw std::out_of_range("expected_vector index out of range");
+				}
+				return const_reference(this, index);
+			}
+
+			value_range values() const
+			{
+				return value_range(this);
+			}
+
+			const std::vector<std::pair<std::size_t, E>>& errors() const noexcept
+			{
+				return _errors;
+			}
+
+			const std::vector<std::uint64_t>& bitmap() const noexcept
+			{
+				return _bitmap;
+			}
+	};
+
+#if defined(_source_location)
+	}
+#endif
+}
@@ -0,0 +1,333 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <cstdio>
+#include <cstring>
+
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	namespace detail {
+		inline const char* append_literal(std::string& out, const char* format)
+		{
+			while (*format != '\0')
+			{
+				if (format[0] == '{' && format[1] == '}')
+					return format + 2;
+				if ((format[0] == '{' && format[1] == '{') || (format[0] == '}' && format[1] == '}'))
+					format++;
+				out += *format++;
+			}
+			return nullptr;
+		}
+
+		// string arguments usually point into temporaries that are gone by the time the message
+		// is rendered, so their characters are copied when the error is made; longer strings are
+		// cut and marked with "..."
+		struct alignas(8) captured_string {
+				static constexpr std::size_t capacity = 47;
+
+				char	      data[capacity];
+				unsigned char size;
+
+				// one bounded pass instead of strlen and memcpy, since arguments are short and a
+				// long one is cut anyway
+				captured_string(const char* value) noexcept : data(), size(0)
+				{
+					if (value == nullptr)
+					{
+						this->assign("(null)", 6);
+						return;
+					}
+
+					// the terminator is looked for one character past the buffer at most, and only
+					// after every character before it was found to be part of the string
+					std::size_t length = 0;
+					bool	    cut	   = false;
+					for (; value[length] != '\0'; length++)
+					{
+						if (length == capacity)
+						{
+							cut = true;
+							break;
+						}
+						data[length] = value[length];
+					}
+					if (cut)
+						std::memcpy(data + capacity - 3, "...", 3);
+					size = static_cast<unsigned char>(length);
+				}
+
+				captured_string(const char* value, std::size_t length) noexcept : data(), size(0)
+				{
+					this->assign(value, length);
+				}
+
+				captured_string(const std::string& value) noexcept : captured_string(value.data(), value.size())
+				{
+				}
+
+#if __cplusplus >= 201703L
+				captured_string(std::string_view value) noexcept : captured_string(value.data(), value.size())
+				{
+				}
+#endif
+
+				void assign(const char* value, std::size_t length) noexcept
+				{
+					std::size_t kept = length <= capacity ? length : capacity - 3;
+					if (kept != 0)
+						std::memcpy(data, value, kept);
+					if (kept != length)
+					{
+						std::memcpy(data + kept, "...", 3);
+						kept += 3;
+					}
+					size = static_cast<unsigned char>(kept);
+				}
+		};
+
+		template<class V>
+		struct captured_argument {
+				using type = V;
+		};
+
+		template<>
+		struct captured_argument<const char*> {
+				using type = captured_string;
+		};
+
+		template<>
+		struct captured_argument<char*> {
+				using type = captured_string;
+		};
+
+		template<>
+		struct captured_argument<std::string> {
+				using type = captured_string;
+		};
+
+#if __cplusplus >= 201703L
+		template<>
+		struct captured_argument<std::string_view> {
+				using type = captured_string;
+		};
+#endif
+
+		inline void append_argument(std::string& out, const captured_string& value)
+		{
+			out.append(value.data, value.size);
+		}
+
+		inline void append_argument(std::string& out, char value)
+		{
+			out += value;
+		}
+
+		inline void append_argument(std::string& out, bool value)
+		{
+			out += value ? "true" : "false";
+		}
+
+		template<class V>
+		typename std::enable_if<std::is_integral<V>::value>::type append_argument(std::string& out, V value)
+		{
+			out += std::to_string(value);
+		}
+
+		template<class V>
+		typename std::enable_if<std::is_enum<V>::value>::type append_argument(std::string& out, V value)
+		{
+			out += std::to_string(static_cast<typename std::underlying_type<V>::type>(value));
+		}
+
+		template<class V>
+		typename std::enable_if<std::is_floating_point<V>::value>::type append_argument(std::string& out, V value)
+		{
+			char buffer[32];
+			int  length = std::snprintf(buffer, sizeof(buffer), "%g", static_cast<double>(value));
+			out.append(buffer, static_cast<std::size_t>(length));
+		}
+
+		template<class V>
+		typename std::enable_if<std::is_pointer<V>::value
+					&& not std::is_same<typename std::remove_cv<typename std::remove_pointer<V>::type>::type, char>::value>::type
+		    append_argument(std::string& out, V value)
+		{
+			char buffer[32];
+			int  length = std::snprintf(buffer, sizeof(buffer), "%p", static_cast<const volatile void*>(value));
+			out.append(buffer, static_cast<std::size_t>(length));
+		}
+
+		template<class... Args>
+		struct packed_arguments;
+
+		template<>
+		struct packed_arguments<> {
+				constexpr packed_arguments() noexcept
+				{
+				}
+
+				void render(std::string& out, const char* format) const
+				{
+					while (format != nullptr)
+					{
+						format = append_literal(out, format);
+						if (format != nullptr)
+							out += "{}";
+					}
+				}
+		};
+
+		template<class Head>
+		struct packed_arguments<Head> {
+				Head head;
+
+				constexpr explicit packed_arguments(Head first) noexcept : head(first)
+				{
+				}
+
+				void render(std::string& out, const char* format) const
+				{
+					const char* rest = append_literal(out, format);
+					if (rest == nullptr)
+						return;
+					append_argument(out, head);
+					packed_arguments<>().render(out, rest);
+				}
+		};
+
+		template<class Head, class... Tail>
+		struct packed_arguments<Head, Tail...> {
+				Head			 head;
+				packed_arguments<Tail...> tail;
+
+				constexpr packed_arguments(Head first, Tail... rest) noexcept : head(first), tail(rest...)
+				{
+				}
+
+				void render(std::string& out, const char* format) const
+				{
+					const char* rest = append_literal(out, format);
+					if (rest == nullptr)
+						return;
+					append_argument(out, head);
+					tail.render(out, rest);
+				}
+		};
+
+		template<class... Args>
+		struct all_trivially_copyable : std::true_type {};
+
+		template<class Head, class... Tail>
+		struct all_trivially_copyable<Head, Tail...>
+		    : std::integral_constant<bool, std::is_trivially_copyable<Head>::value && all_trivially_copyable<Tail...>::value> {};
+
+#if defined(__cpp_consteval)
+		// walks the string the way append_literal does, {{ and }} being escapes
+		consteval std::size_t count_placeholders(const char* format)
+		{
+			std::size_t count = 0;
+			while (format != nullptr && *format != '\0')
+			{
+				if (format[0] == '{' && format[1] == '}')
+				{
+					count++;
+					format += 2;
+				}
+				else if ((format[0] == '{' && format[1] == '{') || (format[0] == '}' && format[1] == '}'))
+					format += 2;
+				else
+					format++;
+			}
+			return count;
+		}
+
+		// not constexpr, so reaching it while a format string is checked fails the build with its name
+		inline void format_placeholders_do_not_match_arguments() noexcept
+		{
+		}
+
+		template<class... Args>
+		struct checked_format {
+				const char* value;
+
+				consteval checked_format(const char* format) : value(format)
+				{
+					if (count_placeholders(format) != sizeof...(Args))
+						format_placeholders_do_not_match_arguments();
+				}
+
+				constexpr operator const char*() const noexcept
+				{
+					return value;
+				}
+		};
+
+		template<class... Args>
+		using format_string = checked_format<Args...>;
+#else
+		template<class... Args>
+		using format_string = const char*;
+#endif
+	}
+
+	// the format string is kept by pointer and must outlive the error, which a string literal
+	// always does; string arguments are copied, everything else is stored by value. from C++20 on
+	// the format string must be a constant whose placeholders match the arguments
+	template<class... Args>
+	class format_error {
+		private:
+			static_assert(detail::all_trivially_copyable<typename detail::captured_argument<Args>::type...>::value,
+			    "format_error arguments must be trivially copyable");
+
+			const char*									_format;
+			detail::packed_arguments<typename detail::captured_argument<Args>::type...> _arguments;
+
+		public:
+			constexpr format_error(detail::format_string<Args...> format, const Args&... arguments) noexcept
+			    : _format(format), _arguments(arguments...)
+			{
+			}
+
+			constexpr const char* format() const noexcept
+			{
+				return _format;
+			}
+
+			std::string message() const
+			{
+				std::string out;
+				_arguments.render(out, _format);
+				return out;
+			}
+	};
+
+#if defined(__cpp_deduction_guides)
+	template<class... Args>
+	format_error(const char*, Args...) -> format_error<typename std::decay<Args>::type...>;
+#endif
+
+	template<class... Args>
+	constexpr format_error<typename std::decay<Args>::type...> make_format_error(
+	    detail::format_string<typename std::decay<Args>::type...> format, Args&&... arguments) noexcept
+	{
+		return format_error<typename std::decay<Args>::type...>(format, arguments...);
+	}
+
+#if defined(_source_location)
+	}
+#endif
+}
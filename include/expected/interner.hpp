@@ -0,0 +1,224 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <expected/detail/backoff.hpp>
+#include <atomic>
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	class message_interner {
+		private:
+			std::size_t					   _capacity;
+			std::size_t					   _mask;
+			std::unique_ptr<std::atomic<std::uint64_t>[]>	   _slots;
+			std::unique_ptr<std::atomic<const std::string*>[]> _messages;
+			std::atomic<std::uint32_t>			   _next;
+
+			static std::uint32_t hash(const char* text, std::size_t size) noexcept
+			{
+				std::uint64_t hash = 14695981039346656037ull;
+				for (std::size_t i = 0; i < size; i++)
+				{
+					hash ^= static_cast<unsigned char>(text[i]);
+					hash *= 1099511628211ull;
+				}
+				return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+			}
+
+			// a slot is claimed with the pending id before an id is taken, so only the thread that
+			// owns a slot ever consumes an id and the ids stay dense under contention; a slot whose
+			// owner ran out of ids is left dead and skipped
+			static constexpr std::uint32_t pending_id = 0xffffffffu;
+			static constexpr std::uint32_t dead_id	  = 0xfffffffeu;
+
+			static std::uint64_t pack(std::uint32_t hash, std::uint32_t id) noexcept
+			{
+				return static_cast<std::uint64_t>(hash) << 32 | id;
+			}
+
+			std::uint64_t settled(std::size_t index, std::uint64_t slot, std::uint32_t hash) const noexcept
+			{
+				detail::backoff delay;
+				while (slot == pack(hash, pending_id))
+				{
+					delay.pause();
+					slot = _slots[index].load(std::memory_order_acquire);
+				}
+				return slot;
+			}
+
+			bool matches(std::uint64_t slot, std::uint32_t hash, const char* text, std::size_t size) const noexcept
+			{
+				std::uint32_t id = static_cast<std::uint32_t>(slot);
+				if (static_cast<std::uint32_t>(slot >> 32) != hash || id == dead_id)
+					return false;
+				const std::string* message = _messages[id - 1].load(std::memory_order_acquire);
+				return message->size() == size && std::memcmp(message->data(), text, size) == 0;
+			}
+
+			std::uint32_t fill(std::size_t index, std::uint32_t hash, const char* text, std::size_t size)
+			{
+				std::uint32_t id = _next.fetch_add(1, std::memory_order_relaxed) + 1;
+				if (id > _capacity)
+				{
+					_slots[index].store(pack(hash, dead_id), std::memory_order_release);
+					throw std::runtime_error("Attempted to intern a message into a full interner");
+				}
+
+				try
+				{
+					_messages[id - 1].store(new std::string(text, size), std::memory_order_release);
+				}
+				catch (...)
+				{
+					_slots[index].store(pack(hash, dead_id), std::memory_order_release);
+					throw;
+				}
+				_slots[index].store(pack(hash, id), std::memory_order_release);
+				return id;
+			}
+
+		public:
+			explicit message_interner(std::size_t capacity = 65536) : _capacity(capacity), _next(0)
+			{
+				std::size_t slots = 2;
+				while (slots < capacity * 2)
+					slots *= 2;
+				_mask = slots - 1;
+				_slots.reset(new std::atomic<std::uint64_t>[slots]);
+				_messages.reset(new std::atomic<const std::string*>[capacity]);
+				for (std::size_t i = 0; i < slots; i++)
+					_slots[i].store(0, std::memory_order_relaxed);
+				for (std::size_t i = 0; i < capacity; i++)
+					_messages[i].store(nullptr, std::memory_order_relaxed);
+			}
+
+			message_interner(const message_interner&) = delete;
+			message_interner& operator=(const message_interner&) = delete;
+
+			~message_interner()
+			{
+				for (std::size_t i = 0; i < _capacity; i++)
+					delete _messages[i].load(std::memory_order_relaxed);
+			}
+
+			static message_interner& global()
+			{
+				static message_interner interner;
+				return interner;
+			}
+
+			std::uint32_t intern(const char* text, std::size_t size)
+			{
+				std::uint32_t hash = message_interner::hash(text, size);
+				for (std::size_t i = hash & _mask, probes = 0; probes <= _mask; i = (i + 1) & _mask, probes++)
+				{
+					std::uint64_t slot = _slots[i].load(std::memory_order_acquire);
+					if (slot == 0)
+					{
+						if (_slots[i].compare_exchange_strong(slot, pack(hash, pending_id), std::memory_order_acq_rel, std::memory_order_acquire))
+							return this->fill(i, hash, text, size);
+					}
+					slot = this->settled(i, slot, hash);
+					if (this->matches(slot, hash, text, size))
+						return static_cast<std::uint32_t>(slot);
+				}
+				throw std::runtime_error("Attempted to intern a message into a full interner");
+			}
+
+			std::uint32_t intern(const std::string& text)
+			{
+				return this->intern(text.data(), text.size());
+			}
+
+			std::uint32_t intern(const char* text)
+			{
+				return this->intern(text, std::strlen(text));
+			}
+
+			std::uint32_t find(const char* text, std::size_t size) const noexcept
+			{
+				std::uint32_t hash = message_interner::hash(text, size);
+				for (std::size_t i = hash & _mask, probes = 0; probes <= _mask; i = (i + 1) & _mask, probes++)
+				{
+					// a pending slot is skipped rather than waited on, so readers never block; its text is
+					// not interned yet, and no later slot can hold it because intern waits on this one
+					std::uint64_t slot = _slots[i].load(std::memory_order_acquire);
+					if (slot == 0)
+						return 0;
+					if (static_cast<std::uint32_t>(slot) == pending_id)
+						continue;
+					if (this->matches(slot, hash, text, size))
+						return static_cast<std::uint32_t>(slot);
+				}
+				return 0;
+			}
+
+			const std::string& text(std::uint32_t id) const
+			{
+				const std::string* message = id != 0 && id <= _capacity ? _messages[id - 1].load(std::memory_order_acquire) : nullptr;
+				if (message == nullptr)
+				{
+					throw std::runtime_error("Attempted to look up a message id that was never interned");
+				}
+				return *message;
+			}
+
+			std::size_t size() const noexcept
+			{
+				std::size_t next = _next.load(std::memory_order_relaxed);
+				return next < _capacity ? next : _capacity;
+			}
+	};
+
+	class interned_error {
+		private:
+			std::uint32_t _id;
+
+		public:
+			constexpr explicit interned_error(std::uint32_t id) noexcept : _id(id)
+			{
+			}
+
+			explicit interned_error(const char* message) : _id(message_interner::global().intern(message))
+			{
+			}
+
+			explicit interned_error(const std::string& message) : _id(message_interner::global().intern(message))
+			{
+			}
+
+			constexpr std::uint32_t id() const noexcept
+			{
+				return _id;
+			}
+
+			const std::string& message() const
+			{
+				return message_interner::global().text(_id);
+			}
+
+			friend constexpr bool operator==(interned_error lhs, interned_error rhs) noexcept
+			{
+				return lhs._id == rhs._id;
+			}
+
+			friend constexpr bool operator!=(interned_error lhs, interned_error rhs) noexcept
+			{
+				return lhs._id != rhs._id;
+			}
+	};
+
+#if defined(_source_location)
+	}
+#endif
+}
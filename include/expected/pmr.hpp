@@ -0,0 +1,38 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+#endif
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+#if defined(__cpp_lib_memory_resource)
+	namespace pmr {
+		template<class T = monostate, class E = std::pmr::string>
+		using expected = nl::expected<T, E>;
+
+		inline expected<monostate> unexpected(
+		    const char* e, std::pmr::memory_resource* resource = std::pmr::get_default_resource() _location_param)
+		{
+			return expected<monostate>(std::pmr::string(e, resource) _location_arg);
+		}
+	}
+#endif
+
+#if defined(_source_location)
+	}
+#endif
+}
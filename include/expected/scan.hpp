@@ -0,0 +1,443 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <expected/expected_vector.hpp>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define _simd_x86
+#include <immintrin.h>
+#endif
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	namespace detail {
+		inline std::uint64_t tail_mask(std::size_t bits) noexcept
+		{
+			return bits >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << bits) - 1;
+		}
+
+		inline std::size_t next_dirty_word_scalar(const std::uint64_t* words, std::size_t from, std::size_t to) noexcept
+		{
+			for (; from < to; from++)
+			{
+				if (words[from] != ~std::uint64_t(0))
+					break;
+			}
+			return from;
+		}
+
+		inline std::size_t next_dirty_block_scalar(const unsigned char* base, std::size_t stride, std::size_t from, std::size_t to) noexcept
+		{
+			for (; from < to; from++)
+			{
+				const unsigned char* block = base + from * 64 * stride;
+				unsigned char	     clean = 1;
+				for (std::size_t i = 0; i < 64; i++)
+					clean &= block[i * stride];
+				if (not clean)
+					break;
+			}
+			return from;
+		}
+
+		inline std::size_t count_clear_bytes_scalar(const unsigned char* base, std::size_t stride, std::size_t count) noexcept
+		{
+			std::size_t clear = 0;
+			for (std::size_t i = 0; i < count; i++)
+				clear += base[i * stride] == 0;
+			return clear;
+		}
+
+#if defined(_simd_x86)
+		inline std::uint32_t lane_mask(std::size_t stride, std::size_t width) noexcept
+		{
+			std::uint32_t mask = 0;
+			for (std::size_t i = 0; i < width; i += stride)
+				mask |= std::uint32_t(1) << i;
+			return mask;
+		}
+
+		inline std::size_t count_clear_bytes_sse2(const unsigned char* base, std::size_t stride, std::size_t count) noexcept
+		{
+			const __m128i	    zero   = _mm_setzero_si128();
+			const std::uint32_t lanes  = lane_mask(stride, 16);
+			const std::size_t   bytes  = count * stride;
+			std::size_t	    clear  = 0;
+			std::size_t	    offset = 0;
+			for (; offset + 16 <= bytes; offset += 16)
+			{
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(base + offset));
+				clear += static_cast<std::size_t>(popcount(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero))) & lanes));
+			}
+			return clear + count_clear_bytes_scalar(base + offset, stride, (bytes - offset) / stride);
+		}
+
+		__attribute__((target("avx2,popcnt"))) inline std::size_t count_clear_bytes_avx2(
+		    const unsigned char* base, std::size_t stride, std::size_t count) noexcept
+		{
+			const __m256i	    zero   = _mm256_setzero_si256();
+			const std::uint32_t lanes  = lane_mask(stride, 32);
+			const std::size_t   bytes  = count * stride;
+			std::size_t	    clear  = 0;
+			std::size_t	    offset = 0;
+			for (; offset + 32 <= bytes; offset += 32)
+			{
+				__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(base + offset));
+				clear += static_cast<std::size_t>(
+				    __builtin_popcount(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero))) & lanes));
+			}
+			return clear + count_clear_bytes_scalar(base + offset, stride, (bytes - offset) / stride);
+		}
+
+		inline std::size_t next_dirty_word_sse2(const std::uint64_t* words, std::size_t from, std::size_t to) noexcept
+		{
+			const __m128i ones = _mm_set1_epi32(-1);
+			for (; from + 2 <= to; from += 2)
+			{
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + from));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi32(v, ones)) != 0xFFFF)
+					break;
+			}
+			return next_dirty_word_scalar(words, from, to);
+		}
+
+		__attribute__((target("avx2"))) inline std::size_t next_dirty_word_avx2(
+		    const std::uint64_t* words, std::size_t from, std::size_t to) noexcept
+		{
+			const __m256i ones = _mm256_set1_epi32(-1);
+			for (; from + 4 <= to; from += 4)
+			{
+				__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + from));
+				if (_mm256_movemask_epi8(_mm256_cmpeq_epi64(v, ones)) != -1)
+					break;
+			}
+			return next_dirty_word_scalar(words, from, to);
+		}
+
+		inline __m128i discriminant_pattern_sse2(std::size_t stride) noexcept
+		{
+			alignas(16) unsigned char pattern[16] = {};
+			for (std::size_t i = 0; i < 16; i += stride)
+				pattern[i] = 0xFF;
+			return _mm_load_si128(reinterpret_cast<const __m128i*>(pattern));
+		}
+
+		inline std::size_t next_dirty_block_sse2(const unsigned char* base, std::size_t stride, std::size_t from, std::size_t to) noexcept
+		{
+			const __m128i zero    = _mm_setzero_si128();
+			const __m128i pattern = discriminant_pattern_sse2(stride);
+			for (; from < to; from++)
+			{
+				const unsigned char* block = base + from * 64 * stride;
+				__m128i		     acc   = zero;
+				for (std::size_t offset = 0; offset < 64 * stride; offset += 16)
+				{
+					__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + offset));
+					acc	  = _mm_or_si128(acc, _mm_and_si128(_mm_cmpeq_epi8(v, zero), pattern));
+				}
+				if (_mm_movemask_epi8(acc) != 0)
+					break;
+			}
+			return from;
+		}
+
+		__attribute__((target("avx2"))) inline std::size_t next_dirty_block_avx2(
+		    const unsigned char* base, std::size_t stride, std::size_t from, std::size_t to) noexcept
+		{
+			alignas(32) unsigned char bytes[32] = {};
+			for (std::size_t i = 0; i < 32; i += stride)
+				bytes[i] = 0xFF;
+			const __m256i zero    = _mm256_setzero_si256();
+			const __m256i pattern = _mm256_load_si256(reinterpret_cast<const __m256i*>(bytes));
+			for (; from < to; from++)
+			{
+				const unsigned char* block = base + from * 64 * stride;
+				__m256i		     acc   = zero;
+				for (std::size_t offset = 0; offset < 64 * stride; offset += 32)
+				{
+					__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + offset));
+					acc	  = _mm256_or_si256(acc, _mm256_and_si256(_mm256_cmpeq_epi8(v, zero), pattern));
+				}
+				if (not _mm256_testz_si256(acc, acc))
+					break;
+			}
+			return from;
+		}
+
+		// the avx2 kernels are built with target("avx2,popcnt"), so both features must be present
+		inline bool has_avx2() noexcept
+		{
+			static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+			return supported;
+		}
+#endif
+
+		inline std::size_t next_dirty_word(const std::uint64_t* words, std::size_t from, std::size_t to) noexcept
+		{
+#if defined(_simd_x86)
+			if (has_avx2())
+				return next_dirty_word_avx2(words, from, to);
+			return next_dirty_word_sse2(words, from, to);
+#else
+			return next_dirty_word_scalar(words, from, to);
+#endif
+		}
+
+		inline std::size_t next_dirty_block(const unsigned char* base, std::size_t stride, std::size_t from, std::size_t to) noexcept
+		{
+#if defined(_simd_x86)
+			if (stride <= 8)
+			{
+				if (has_avx2())
+					return next_dirty_block_avx2(base, stride, from, to);
+				return next_dirty_block_sse2(base, stride, from, to);
+			}
+#endif
+			return next_dirty_block_scalar(base, stride, from, to);
+		}
+
+		inline std::size_t count_clear_bytes(const unsigned char* base, std::size_t stride, std::size_t count) noexcept
+		{
+#if defined(_simd_x86)
+			if (stride <= 8)
+			{
+				if (has_avx2())
+					return count_clear_bytes_avx2(base, stride, count);
+				return count_clear_bytes_sse2(base, stride, count);
+			}
+#endif
+			return count_clear_bytes_scalar(base, stride, count);
+		}
+
+		template<class Source>
+		std::size_t count_errors_by_block(const Source& source) noexcept
+		{
+			std::size_t count = 0;
+			for (std::size_t block = source.next_dirty(0); block < source.blocks(); block = source.next_dirty(block + 1))
+				count += static_cast<std::size_t>(popcount(source.error_mask(block)));
+			return count;
+		}
+
+		class bitmap_source {
+			private:
+				const std::uint64_t* _words;
+				std::size_t	     _count;
+
+			public:
+				bitmap_source(const std::uint64_t* words, std::size_t count) : _words(words), _count(count)
+				{
+				}
+
+				std::size_t count() const noexcept
+				{
+					return _count;
+				}
+
+				std::size_t blocks() const noexcept
+				{
+					return (_count + 63) / 64;
+				}
+
+				std::size_t next_dirty(std::size_t from) const noexcept
+				{
+					std::size_t full = _count / 64;
+					if (from < full)
+					{
+						from = next_dirty_word(_words, from, full);
+						if (from < full)
+							return from;
+					}
+					if (from < this->blocks() && this->error_mask(from) == 0)
+						from++;
+					return from;
+				}
+
+				std::uint64_t error_mask(std::size_t block) const noexcept
+				{
+					return ~_words[block] & tail_mask(_count - block * 64);
+				}
+		};
+
+		template<class T, class E>
+		class array_source {
+			private:
+				const expected<T, E>* _first;
+				std::size_t	      _count;
+
+				static constexpr bool packed_discriminant = std::is_standard_layout<expected<T, E>>::value &&
+				    (sizeof(expected<T, E>) & (sizeof(expected<T, E>) - 1)) == 0 && sizeof(expected<T, E>) <= 8;
+
+			public:
+				array_source(const expected<T, E>* first, std::size_t count) : _first(first), _count(count)
+				{
+				}
+
+				std::size_t count() const noexcept
+				{
+					return _count;
+				}
+
+				std::size_t blocks() const noexcept
+				{
+					return (_count + 63) / 64;
+				}
+
+				std::size_t next_dirty(std::size_t from) const noexcept
+				{
+					std::size_t full = _count / 64;
+					if (packed_discriminant && from < full)
+					{
+						from = next_dirty_block(reinterpret_cast<const unsigned char*>(_first), sizeof(expected<T, E>), from, full);
+						if (from < full)
+							return from;
+					}
+					while (from < this->blocks() && this->error_mask(from) == 0)
+						from++;
+					return from;
+				}
+
+				// counting visits every element anyway, so packed discriminants are counted straight
+				// from memory instead of skipping clean blocks and rebuilding masks for dirty ones
+				std::size_t count_errors() const noexcept
+				{
+					if (not packed_discriminant)
+						return detail::count_errors_by_block(*this);
+					return count_clear_bytes(reinterpret_cast<const unsigned char*>(_first), sizeof(expected<T, E>), _count);
+				}
+
+				std::uint64_t error_mask(std::size_t block) const noexcept
+				{
+					const expected<T, E>* first = _first + block * 64;
+					std::size_t	      n	    = _count - block * 64 < 64 ? _count - block * 64 : 64;
+					std::uint64_t	      mask  = 0;
+					for (std::size_t i = 0; i < n; i++)
+						mask |= std::uint64_t(not first[i].has_value()) << i;
+					return mask;
+				}
+		};
+
+		template<class Source>
+		bool any_error(const Source& source) noexcept
+		{
+			return source.next_dirty(0) < source.blocks();
+		}
+
+		inline std::size_t count_errors(const bitmap_source& source) noexcept
+		{
+			return count_errors_by_block(source);
+		}
+
+		template<class T, class E>
+		std::size_t count_errors(const array_source<T, E>& source) noexcept
+		{
+			return source.count_errors();
+		}
+
+		template<class Source>
+		std::size_t first_error_index(const Source& source) noexcept
+		{
+			std::size_t block = source.next_dirty(0);
+			if (block == source.blocks())
+				return source.count();
+			return block * 64 + static_cast<std::size_t>(countr_zero(source.error_mask(block)));
+		}
+
+		template<class Source>
+		std::vector<std::size_t> error_indices(const Source& source)
+		{
+			std::vector<std::size_t> indices;
+			for (std::size_t block = source.next_dirty(0); block < source.blocks(); block = source.next_dirty(block + 1))
+			{
+				for (std::uint64_t mask = source.error_mask(block); mask != 0; mask &= mask - 1)
+					indices.push_back(block * 64 + static_cast<std::size_t>(countr_zero(mask)));
+			}
+			return indices;
+		}
+	}
+
+	inline bool any_error(const std::uint64_t* bitmap, std::size_t count) noexcept
+	{
+		return detail::any_error(detail::bitmap_source(bitmap, count));
+	}
+
+	inline std::size_t count_errors(const std::uint64_t* bitmap, std::size_t count) noexcept
+	{
+		return detail::count_errors(detail::bitmap_source(bitmap, count));
+	}
+
+	inline std::size_t first_error_index(const std::uint64_t* bitmap, std::size_t count) noexcept
+	{
+		return detail::first_error_index(detail::bitmap_source(bitmap, count));
+	}
+
+	inline std::vector<std::size_t> error_indices(const std::uint64_t* bitmap, std::size_t count)
+	{
+		return detail::error_indices(detail::bitmap_source(bitmap, count));
+	}
+
+	template<class T, class E>
+	bool any_error(const expected<T, E>* first, std::size_t count) noexcept
+	{
+		return detail::any_error(detail::array_source<T, E>(first, count));
+	}
+
+	template<class T, class E>
+	std::size_t count_errors(const expected<T, E>* first, std::size_t count) noexcept
+	{
+		return detail::count_errors(detail::array_source<T, E>(first, count));
+	}
+
+	template<class T, class E>
+	std::size_t first_error_index(const expected<T, E>* first, std::size_t count) noexcept
+	{
+		return detail::first_error_index(detail::array_source<T, E>(first, count));
+	}
+
+	template<class T, class E>
+	std::vector<std::size_t> error_indices(const expected<T, E>* first, std::size_t count)
+	{
+		return detail::error_indices(detail::array_source<T, E>(first, count));
+	}
+
+	template<class T, class E>
+	bool any_error(const expected_vector<T, E>& results) noexcept
+	{
+		return results.error_count() != 0;
+	}
+
+	template<class T, class E>
+	std::size_t count_errors(const expected_vector<T, E>& results) noexcept
+	{
+		return results.error_count();
+	}
+
+	template<class T, class E>
+	std::size_t first_error_index(const expected_vector<T, E>& results) noexcept
+	{
+		return results.errors().empty() ? results.size() : results.errors().front().first;
+	}
+
+	template<class T, class E>
+	std::vector<std::size_t> error_indices(const expected_vector<T, E>& results)
+	{
+		std::vector<std::size_t> indices;
+		indices.reserve(results.error_count());
+		for (const auto& entry : results.errors())
+			indices.push_back(entry.first);
+		return indices;
+	}
+
+#if defined(_source_location)
+	}
+#endif
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <functional>
+#include <tuple>
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+#if __cplusplus >= 201703L
+	namespace detail {
+		template<class Result>
+		struct is_expected : std::false_type {};
+
+		template<class T, class E>
+		struct is_expected<expected<T, E>> : std::true_type {};
+
+		template<class E, class First, class... Rest>
+		E first_error(First&& first, Rest&&... rest)
+		{
+			if constexpr (sizeof...(Rest) == 0)
+				return E(expected_access::error(std::forward<First>(first)));
+			else if (not first.has_value())
+				return E(expected_access::error(std::forward<First>(first)));
+			else
+				return detail::first_error<E>(std::forward<Rest>(rest)...);
+		}
+
+#if defined(_source_location)
+		template<class First, class... Rest>
+		constexpr std::source_location first_location(const First& first, const Rest&... rest) noexcept
+		{
+			if constexpr (sizeof...(Rest) == 0)
+				return first.error_location();
+			else if (not first.has_value())
+				return first.error_location();
+			else
+				return detail::first_location(rest...);
+		}
+#endif
+
+		// counting the present discriminants and comparing once leaves GCC a single branch; a
+		// fold over & still gets split into two
+		template<class... Results>
+		constexpr bool all_present(const Results&... results) noexcept
+		{
+			return (static_cast<unsigned>(results.has_value()) + ...) == sizeof...(Results);
+		}
+
+		template<class... Results>
+		struct sequence_error;
+
+		template<class First, class... Rest>
+		struct sequence_error<First, Rest...> {
+				using type = typename std::remove_cv_t<std::remove_reference_t<First>>::error_type;
+		};
+	}
+
+	template<class... Results, class E = typename detail::sequence_error<Results...>::type>
+	expected<std::tuple<typename std::remove_cv_t<std::remove_reference_t<Results>>::value_type...>, E> sequence(Results&&... results)
+	{
+		using tuple_type = std::tuple<typename std::remove_cv_t<std::remove_reference_t<Results>>::value_type...>;
+
+		if (detail::all_present(results...))
+			return expected<tuple_type, E>(tuple_type(*std::forward<Results>(results)...));
+		else
+			return expected<tuple_type, E>(
+			    detail::first_error<E>(std::forward<Results>(results)...) _location_with(detail::first_location(results...)));
+	}
+
+	template<class F, class... Results, class E = typename detail::sequence_error<Results...>::type>
+	auto apply_ok(F&& f, Results&&... results)
+	{
+		using mapped = std::remove_cv_t<std::remove_reference_t<std::invoke_result_t<F, decltype(*std::forward<Results>(results))...>>>;
+		using output = std::conditional_t<detail::is_expected<mapped>::value, mapped, expected<mapped, E>>;
+
+		if (detail::all_present(results...))
+			return output(std::invoke(std::forward<F>(f), *std::forward<Results>(results)...));
+		else
+			return output(detail::first_error<E>(std::forward<Results>(results)...) _location_with(detail::first_location(results...)));
+	}
+#endif
+
+#if defined(_source_location)
+	}
+#endif
+}
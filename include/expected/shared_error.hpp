@@ -0,0 +1,192 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <expected/error_pool.hpp>
+#include <atomic>
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	struct atomic_refcount {
+			using count_type = std::atomic<std::size_t>;
+
+			static void increment(count_type& count) noexcept
+			{
+				count.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			static bool decrement(count_type& count) noexcept
+			{
+				return count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+			}
+
+			static std::size_t load(const count_type& count) noexcept
+			{
+				return count.load(std::memory_order_relaxed);
+			}
+	};
+
+	struct local_refcount {
+			using count_type = std::size_t;
+
+			static void increment(count_type& count) noexcept
+			{
+				count++;
+			}
+
+			static bool decrement(count_type& count) noexcept
+			{
+				return --count == 0;
+			}
+
+			static std::size_t load(const count_type& count) noexcept
+			{
+				return count;
+			}
+	};
+
+	template<class E, class Policy = atomic_refcount>
+	class shared_error {
+		private:
+			struct node {
+					typename Policy::count_type refs;
+					const E			    error;
+
+					template<class... Args>
+					explicit node(Args&&... args) : refs(1), error(std::forward<Args>(args)...)
+					{
+					}
+			};
+
+			static_assert(alignof(node) <= alignof(std::max_align_t), "over-aligned errors cannot be shared");
+
+			node* _node;
+
+			template<class... Args>
+			static node* create(Args&&... args)
+			{
+				void* memory = detail::error_pool::allocate(sizeof(node));
+				try
+				{
+					return new (memory) node(std::forward<Args>(args)...);
+				}
+				catch (...)
+				{
+					detail::error_pool::deallocate(memory);
+					throw;
+				}
+			}
+
+			void release() noexcept
+			{
+				if (_node != nullptr && Policy::decrement(_node->refs))
+				{
+					_node->~node();
+					detail::error_pool::deallocate(_node);
+				}
+			}
+
+		public:
+			using element_type = E;
+			using policy_type  = Policy;
+
+			shared_error(const E& error) : _node(create(error))
+			{
+			}
+
+			shared_error(E&& error) : _node(create(std::move(error)))
+			{
+			}
+
+			shared_error(const shared_error& other) noexcept : _node(other._node)
+			{
+				if (_node != nullptr)
+					Policy::increment(_node->refs);
+			}
+
+			shared_error(shared_error&& other) noexcept : _node(other._node)
+			{
+				other._node = nullptr;
+			}
+
+			shared_error& operator=(const shared_error& other) noexcept
+			{
+				if (_node != other._node)
+				{
+					if (other._node != nullptr)
+						Policy::increment(other._node->refs);
+					this->release();
+					_node = other._node;
+				}
+				return *this;
+			}
+
+			shared_error& operator=(shared_error&& other) noexcept
+			{
+				if (this != &other)
+				{
+					this->release();
+					_node	    = other._node;
+					other._node = nullptr;
+				}
+				return *this;
+			}
+
+			~shared_error()
+			{
+				this->release();
+			}
+
+			const E& get() const noexcept
+			{
+				return _node->error;
+			}
+
+			const E& operator*() const noexcept
+			{
+				return _node->error;
+			}
+
+			const E* operator->() const noexcept
+			{
+				return std::addressof(_node->error);
+			}
+
+			std::size_t use_count() const noexcept
+			{
+				return _node != nullptr ? Policy::load(_node->refs) : 0;
+			}
+
+			// a moved-from handle holds no node; it equals only another empty handle
+			friend bool operator==(const shared_error& lhs, const shared_error& rhs)
+			{
+				if (lhs._node == rhs._node)
+					return true;
+				if (lhs._node == nullptr || rhs._node == nullptr)
+					return false;
+				return lhs._node->error == rhs._node->error;
+			}
+
+			friend bool operator!=(const shared_error& lhs, const shared_error& rhs)
+			{
+				return not(lhs == rhs);
+			}
+	};
+
+	namespace detail {
+		template<class E, class Policy>
+		struct is_error_wrapper<shared_error<E, Policy>> : std::true_type {};
+	}
+
+#if defined(_source_location)
+	}
+#endif
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <cerrno>
+#include <cstdint>
+#include <system_error>
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	// domains are compared by address, so each one must be defined exactly once: an inline or
+	// extern variable, or a static member of a class template as below, never a static in a header
+	struct error_domain {
+			const char*		   name;
+			const char* const*	   messages;
+			std::size_t		   size;
+			const std::errc*	   equivalents;
+			const std::error_category& (*category)();
+	};
+
+	namespace detail {
+		inline const std::error_category& generic_category() noexcept
+		{
+			return std::generic_category();
+		}
+
+		inline const std::error_category& system_category() noexcept
+		{
+			return std::system_category();
+		}
+
+		template<class Tag = void>
+		struct builtin_domains {
+				static constexpr error_domain generic  = {"generic", nullptr, 0, nullptr, &detail::generic_category};
+				static constexpr error_domain system   = {"system", nullptr, 0, nullptr, &detail::system_category};
+				static constexpr error_domain unmapped = {"unmapped", nullptr, 0, nullptr, nullptr};
+		};
+
+#if __cplusplus < 201703L
+		template<class Tag>
+		constexpr error_domain builtin_domains<Tag>::generic;
+
+		template<class Tag>
+		constexpr error_domain builtin_domains<Tag>::system;
+
+		template<class Tag>
+		constexpr error_domain builtin_domains<Tag>::unmapped;
+#endif
+	}
+
+	constexpr const error_domain& generic_domain() noexcept
+	{
+		return detail::builtin_domains<>::generic;
+	}
+
+	constexpr const error_domain& system_domain() noexcept
+	{
+		return detail::builtin_domains<>::system;
+	}
+
+	// codes from a category with no generic equivalent keep their raw value here
+	constexpr const error_domain& unmapped_domain() noexcept
+	{
+		return detail::builtin_domains<>::unmapped;
+	}
+
+	class status_code {
+		private:
+			std::uint32_t	    _code;
+			const error_domain* _domain;
+
+		public:
+			constexpr status_code() noexcept : _code(0), _domain(nullptr)
+			{
+			}
+
+			constexpr status_code(std::uint32_t code, const error_domain& domain) noexcept : _code(code), _domain(&domain)
+			{
+			}
+
+			constexpr std::uint32_t code() const noexcept
+			{
+				return _code;
+			}
+
+			constexpr const error_domain* domain() const noexcept
+			{
+				return _domain;
+			}
+
+			std::string message() const
+			{
+				if (_domain == nullptr)
+					return std::string();
+				if (_domain->category != nullptr)
+					return _domain->category().message(static_cast<int>(_code));
+				if (_domain->messages != nullptr && _code < _domain->size && _domain->messages[_code] != nullptr)
+					return _domain->messages[_code];
+				return std::string(_domain->name) + " error " + std::to_string(_code);
+			}
+
+			bool equivalent(std::errc condition) const noexcept
+			{
+				if (_domain == nullptr)
+					return false;
+				if (_domain->category != nullptr)
+					return std::error_code(static_cast<int>(_code), _domain->category()) == condition;
+				return _domain->equivalents != nullptr && _code < _domain->size && _domain->equivalents[_code] == condition;
+			}
+
+			friend bool operator==(const status_code& lhs, const status_code& rhs) noexcept
+			{
+				return lhs._code == rhs._code && lhs._domain == rhs._domain;
+			}
+
+			friend bool operator!=(const status_code& lhs, const status_code& rhs) noexcept
+			{
+				return not(lhs == rhs);
+			}
+
+			friend bool operator==(const status_code& code, std::errc condition) noexcept
+			{
+				return code.equivalent(condition);
+			}
+
+			friend bool operator!=(const status_code& code, std::errc condition) noexcept
+			{
+				return not code.equivalent(condition);
+			}
+
+			friend bool operator==(std::errc condition, const status_code& code) noexcept
+			{
+				return code.equivalent(condition);
+			}
+
+			friend bool operator!=(std::errc condition, const status_code& code) noexcept
+			{
+				return not code.equivalent(condition);
+			}
+	};
+
+	static_assert(std::is_trivially_copyable<status_code>::value, "");
+
+	inline status_code from_errno(int value = errno) noexcept
+	{
+		return status_code(static_cast<std::uint32_t>(value), generic_domain());
+	}
+
+	inline status_code from_error_code(const std::error_code& code) noexcept
+	{
+		if (code.category() == std::generic_category())
+			return status_code(static_cast<std::uint32_t>(code.value()), generic_domain());
+		if (code.category() == std::system_category())
+			return status_code(static_cast<std::uint32_t>(code.value()), system_domain());
+
+		std::error_condition condition = code.default_error_condition();
+		if (condition.category() == std::generic_category())
+			return status_code(static_cast<std::uint32_t>(condition.value()), generic_domain());
+		return status_code(static_cast<std::uint32_t>(code.value()), unmapped_domain());
+	}
+
+#if defined(_source_location)
+	}
+#endif
+}
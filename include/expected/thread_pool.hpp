@@ -0,0 +1,954 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <expected/detail/backoff.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	namespace detail {
+		template<class U>
+		struct transform_buffer {
+				using type = std::vector<U>;
+
+				static std::vector<U> release(type& buffer)
+				{
+					return std::move(buffer);
+				}
+		};
+
+		// std::vector<bool> packs neighbouring slots into one word, so workers writing adjacent
+		// indices would race; bools are stored a byte each and packed once every worker is done
+		template<>
+		struct transform_buffer<bool> {
+				using type = std::vector<unsigned char>;
+
+				static std::vector<bool> release(type& buffer)
+				{
+					return std::vector<bool>(buffer.begin(), buffer.end());
+				}
+		};
+
+		template<class Iterator, class F, class U, class E>
+		class parallel_transform_state {
+			private:
+				Iterator		 _first;
+				std::size_t		 _count;
+				std::size_t		 _chunk;
+				F&			 _f;
+				typename transform_buffer<U>::type& _out;
+				std::atomic<std::size_t> _next_chunk;
+				std::atomic<std::size_t> _error_index;
+				std::mutex		 _error_mutex;
+				std::unique_ptr<expected<monostate, E>> _error;
+				std::exception_ptr	 _exception;
+
+				template<class Result>
+				void publish(std::size_t index, Result&& result)
+				{
+					std::lock_guard<std::mutex> lock(_error_mutex);
+					if (index < _error_index.load(std::memory_order_relaxed))
+					{
+						_error.reset(new expected<monostate, E>(E(std::forward<Result>(result).error()) _location_with(result.error_location())));
+						_exception = nullptr;
+						_error_index.store(index, std::memory_order_release);
+					}
+				}
+
+				// an exception competes with returned errors by element index, so the earliest
+				// failure wins whichever form it took
+				void publish(std::size_t index, std::exception_ptr exception)
+				{
+					std::lock_guard<std::mutex> lock(_error_mutex);
+					if (index < _error_index.load(std::memory_order_relaxed))
+					{
+						_exception = exception;
+						_error.reset();
+						_error_index.store(index, std::memory_order_release);
+					}
+				}
+
+			public:
+				parallel_transform_state(Iterator first, std::size_t count, std::size_t chunk, F& f, typename transform_buffer<U>::type& out)
+				    : _first(first), _count(count), _chunk(chunk), _f(f), _out(out), _next_chunk(0), _error_index(count)
+				{
+				}
+
+				std::size_t chunks() const noexcept
+				{
+					return (_count + _chunk - 1) / _chunk;
+				}
+
+				void run_chunk(std::size_t chunk)
+				{
+					std::size_t begin = chunk * _chunk;
+					std::size_t end	  = begin + _chunk < _count ? begin + _chunk : _count;
+					if (begin > _error_index.load(std::memory_order_acquire))
+						return;
+
+					std::size_t i = begin;
+					try
+					{
+						for (; i < end; i++)
+						{
+							if (i % 64 == 0 && i > _error_index.load(std::memory_order_relaxed))
+								return;
+
+							auto result = _f(*(_first + static_cast<typename std::iterator_traits<Iterator>::difference_type>(i)));
+							if (result.has_value())
+							{
+								_out[i] = *std::move(result);
+							}
+							else
+							{
+								this->publish(i, std::move(result));
+								return;
+							}
+						}
+					}
+					catch (...)
+					{
+						this->publish(i, std::current_exception());
+					}
+				}
+
+				void run()
+				{
+					std::size_t chunks = this->chunks();
+					for (;;)
+					{
+						std::size_t chunk = _next_chunk.fetch_add(1, std::memory_order_relaxed);
+						if (chunk >= chunks || chunk * _chunk > _error_index.load(std::memory_order_acquire))
+							return;
+						this->run_chunk(chunk);
+					}
+				}
+
+				expected<std::vector<U>, E> result()
+				{
+					if (_exception)
+						std::rethrow_exception(_exception);
+					if (_error)
+						return expected<std::vector<U>, E>(std::move(*_error));
+					return expected<std::vector<U>, E>(transform_buffer<U>::release(_out));
+				}
+		};
+
+		template<class Range, class F>
+		struct transform_result {
+				using type = typename std::decay<decltype(std::declval<F&>()(*std::begin(std::declval<Range&>())))>::type;
+		};
+	}
+
+	class thread_pool;
+
+	namespace detail {
+		struct pool_task {
+				void (*_execute)(pool_task*);
+		};
+
+		template<std::size_t Size>
+		class node_cache {
+			private:
+				std::vector<void*> _free;
+
+			public:
+				~node_cache()
+				{
+					for (void* node : _free)
+						::operator delete(node);
+				}
+
+				static node_cache& local()
+				{
+					static thread_local node_cache cache;
+					return cache;
+				}
+
+				void* allocate()
+				{
+					if (_free.empty())
+						return ::operator new(Size);
+					void* node = _free.back();
+					_free.pop_back();
+					return node;
+				}
+
+				void deallocate(void* node)
+				{
+					if (_free.size() < 1024)
+						_free.push_back(node);
+					else
+						::operator delete(node);
+				}
+		};
+
+		template<class Node>
+		using node_cache_for = node_cache<(sizeof(Node) + 63) / 64 * 64>;
+
+		class work_stealing_deque {
+			private:
+				struct ring {
+						std::int64_t			       capacity;
+						std::unique_ptr<std::atomic<pool_task*>[]> slots;
+
+						explicit ring(std::int64_t size) : capacity(size), slots(new std::atomic<pool_task*>[size])
+						{
+						}
+
+						pool_task* get(std::int64_t index) const noexcept
+						{
+							return slots[index & (capacity - 1)].load(std::memory_order_relaxed);
+						}
+
+						void put(std::int64_t index, pool_task* task) noexcept
+						{
+							slots[index & (capacity - 1)].store(task, std::memory_order_relaxed);
+						}
+				};
+
+				std::atomic<std::int64_t>	   _top;
+				std::atomic<std::int64_t>	   _bottom;
+				std::atomic<ring*>		   _ring;
+				std::vector<std::unique_ptr<ring>> _rings;
+
+				ring* grow(ring* old, std::int64_t top, std::int64_t bottom)
+				{
+					_rings.emplace_back(new ring(old->capacity * 2));
+					ring* bigger = _rings.back().get();
+					for (std::int64_t i = top; i < bottom; i++)
+						bigger->put(i, old->get(i));
+					_ring.store(bigger, std::memory_order_release);
+					return bigger;
+				}
+
+			public:
+				work_stealing_deque() : _top(0), _bottom(0)
+				{
+					_rings.emplace_back(new ring(256));
+					_ring.store(_rings.back().get(), std::memory_order_relaxed);
+				}
+
+				void push(pool_task* task)
+				{
+					std::int64_t bottom = _bottom.load(std::memory_order_relaxed);
+					std::int64_t top    = _top.load(std::memory_order_acquire);
+					ring*	     buffer = _ring.load(std::memory_order_relaxed);
+					if (bottom - top > buffer->capacity - 1)
+						buffer = this->grow(buffer, top, bottom);
+					buffer->put(bottom, task);
+					_bottom.store(bottom + 1, std::memory_order_release);
+				}
+
+				pool_task* pop()
+				{
+					std::int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+					ring*	     buffer = _ring.load(std::memory_order_relaxed);
+					// seq_cst operations rather than standalone fences, so ThreadSanitizer sees the
+					// store-load ordering between the owner's bottom and a thief's top
+					_bottom.store(bottom, std::memory_order_seq_cst);
+					std::int64_t top = _top.load(std::memory_order_seq_cst);
+
+					if (top > bottom)
+					{
+						_bottom.store(bottom + 1, std::memory_order_relaxed);
+						return nullptr;
+					}
+
+					pool_task* task = buffer->get(bottom);
+					if (top == bottom)
+					{
+						if (not _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+							task = nullptr;
+						_bottom.store(bottom + 1, std::memory_order_relaxed);
+					}
+					return task;
+				}
+
+				pool_task* steal()
+				{
+					std::int64_t top    = _top.load(std::memory_order_seq_cst);
+					std::int64_t bottom = _bottom.load(std::memory_order_seq_cst);
+					if (top >= bottom)
+						return nullptr;
+
+					pool_task* task = _ring.load(std::memory_order_acquire)->get(top);
+					if (not _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+						return nullptr;
+					return task;
+				}
+		};
+
+		// shared by when_any and the futures it waits on; every registered future holds a
+		// reference, so a result published after when_any has returned never touches freed memory
+		class completion_signal {
+			private:
+				std::atomic<unsigned>	_refs;
+				std::mutex		_mutex;
+				std::condition_variable _condition;
+				bool			_signalled = false;
+
+			public:
+				completion_signal() : _refs(1)
+				{
+				}
+
+				void retain() noexcept
+				{
+					_refs.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				void release() noexcept
+				{
+					if (_refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+						delete this;
+				}
+
+				void notify()
+				{
+					{
+						std::lock_guard<std::mutex> lock(_mutex);
+						_signalled = true;
+					}
+					_condition.notify_one();
+				}
+
+				void wait_for(std::chrono::microseconds timeout)
+				{
+					std::unique_lock<std::mutex> lock(_mutex);
+					if (timeout.count() == 0)
+						_condition.wait(lock, [this] { return _signalled; });
+					else
+						_condition.wait_for(lock, timeout, [this] { return _signalled; });
+					_signalled = false;
+				}
+		};
+
+		template<class T, class E>
+		class future_state : public pool_task {
+			private:
+				std::atomic<unsigned>		 _refs;
+				std::atomic<bool>		 _ready;
+				std::atomic<completion_signal*> _signal;
+				bool		      _has_result = false;
+				std::exception_ptr    _exception;
+				void (*_recycle)(future_state*);
+
+				union {
+						expected<T, E> _result;
+				};
+
+			public:
+				future_state(void (*execute)(pool_task*), void (*recycle)(future_state*)) : _refs(2), _ready(false), _signal(nullptr), _recycle(recycle)
+				{
+					this->_execute = execute;
+				}
+
+				~future_state()
+				{
+					if (_has_result)
+						_result.~expected();
+				}
+
+				void set_result(expected<T, E>&& result)
+				{
+					new (std::addressof(_result)) expected<T, E>(std::move(result));
+					_has_result = true;
+					this->publish();
+				}
+
+				void set_exception(std::exception_ptr exception)
+				{
+					_exception = exception;
+					this->publish();
+				}
+
+				void publish()
+				{
+					// seq_cst on both sides: either the waiter sees the result or this sees the signal
+					_ready.store(true, std::memory_order_seq_cst);
+#if defined(__cpp_lib_atomic_wait)
+					_ready.notify_all();
+#endif
+					completion_signal* signal = _signal.exchange(nullptr, std::memory_order_seq_cst);
+					if (signal != nullptr)
+					{
+						signal->notify();
+						signal->release();
+					}
+				}
+
+				bool watch(completion_signal* signal) noexcept
+				{
+					signal->retain();
+					_signal.store(signal, std::memory_order_seq_cst);
+					return _ready.load(std::memory_order_seq_cst);
+				}
+
+				void unwatch() noexcept
+				{
+					completion_signal* signal = _signal.exchange(nullptr, std::memory_order_acq_rel);
+					if (signal != nullptr)
+						signal->release();
+				}
+
+				bool ready() const noexcept
+				{
+					return _ready.load(std::memory_order_acquire);
+				}
+
+				void wait() const
+				{
+#if defined(__cpp_lib_atomic_wait)
+					_ready.wait(false, std::memory_order_acquire);
+#else
+					backoff delay;
+					while (not this->ready())
+						delay.pause();
+#endif
+				}
+
+				expected<T, E> take()
+				{
+					if (_exception)
+						std::rethrow_exception(_exception);
+					return std::move(_result);
+				}
+
+				void release() noexcept
+				{
+					if (_refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+						_recycle(this);
+				}
+		};
+
+		template<class F, class T, class E>
+		class future_task : public future_state<T, E> {
+			private:
+				union {
+						F _f;
+				};
+
+				static void execute(pool_task* task)
+				{
+					future_task* self = static_cast<future_task*>(task);
+					try
+					{
+						expected<T, E> result = self->_f();
+						self->_f.~F();
+						self->set_result(std::move(result));
+					}
+					catch (...)
+					{
+						self->_f.~F();
+						self->set_exception(std::current_exception());
+					}
+					self->release();
+				}
+
+				static void recycle(future_state<T, E>* state)
+				{
+					future_task* self = static_cast<future_task*>(state);
+					self->~future_task();
+					node_cache_for<future_task>::local().deallocate(self);
+				}
+
+			public:
+				template<class G>
+				explicit future_task(G&& f) : future_state<T, E>(&future_task::execute, &future_task::recycle)
+				{
+					new (std::addressof(_f)) F(std::forward<G>(f));
+				}
+
+				~future_task()
+				{
+				}
+
+				template<class G>
+				static future_task* create(G&& f)
+				{
+					static_assert(alignof(future_task) <= alignof(std::max_align_t), "over-aligned tasks are not supported");
+					void* memory = node_cache_for<future_task>::local().allocate();
+					try
+					{
+						return new (memory) future_task(std::forward<G>(f));
+					}
+					catch (...)
+					{
+						node_cache_for<future_task>::local().deallocate(memory);
+						throw;
+					}
+				}
+		};
+
+		template<class F>
+		class function_task : public pool_task {
+			private:
+				F _f;
+
+				static void execute(pool_task* task)
+				{
+					function_task* self = static_cast<function_task*>(task);
+					// nothing waits on a posted task, so an exception escaping it has nowhere to go;
+					// letting it unwind the worker loop would terminate the whole pool
+					try
+					{
+						self->_f();
+					}
+					catch (...)
+					{
+					}
+					self->~function_task();
+					node_cache_for<function_task>::local().deallocate(self);
+				}
+
+			public:
+				template<class G>
+				explicit function_task(G&& f) : _f(std::forward<G>(f))
+				{
+					this->_execute = &function_task::execute;
+				}
+
+				template<class G>
+				static function_task* create(G&& f)
+				{
+					static_assert(alignof(function_task) <= alignof(std::max_align_t), "over-aligned tasks are not supported");
+					void* memory = node_cache_for<function_task>::local().allocate();
+					try
+					{
+						return new (memory) function_task(std::forward<G>(f));
+					}
+					catch (...)
+					{
+						node_cache_for<function_task>::local().deallocate(memory);
+						throw;
+					}
+				}
+		};
+
+		struct worker_context {
+				thread_pool* pool  = nullptr;
+				std::size_t  index = 0;
+
+				static worker_context& local()
+				{
+					static thread_local worker_context context;
+					return context;
+				}
+		};
+	}
+
+	template<class T, class E>
+	class expected_future {
+		private:
+			detail::future_state<T, E>* _state;
+
+		public:
+			expected_future() noexcept : _state(nullptr)
+			{
+			}
+
+			explicit expected_future(detail::future_state<T, E>* state) noexcept : _state(state)
+			{
+			}
+
+			expected_future(const expected_future&) = delete;
+			expected_future& operator=(const expected_future&) = delete;
+
+			expected_future(expected_future&& other) noexcept : _state(other._state)
+			{
+				other._state = nullptr;
+			}
+
+			expected_future& operator=(expected_future&& other) noexcept
+			{
+				if (this != &other)
+				{
+					if (_state)
+						_state->release();
+					_state	     = other._state;
+					other._state = nullptr;
+				}
+				return *this;
+			}
+
+			~expected_future()
+			{
+				if (_state)
+					_state->release();
+			}
+
+			bool valid() const noexcept
+			{
+				return _state != nullptr;
+			}
+
+			bool ready() const noexcept
+			{
+				return _state != nullptr && _state->ready();
+			}
+
+			void wait() const;
+
+			template<class U, class G>
+			friend std::pair<std::size_t, expected<U, G>> when_any(std::vector<expected_future<U, G>>& futures);
+
+			expected<T, E> get()
+			{
+				if (not _state)
+				{
+					throw std::runtime_error("Attempted to get the result of an empty future");
+				}
+				this->wait();
+				detail::future_state<T, E>* state = _state;
+				_state				  = nullptr;
+				try
+				{
+					expected<T, E> result = state->take();
+					state->release();
+					return result;
+				}
+				catch (...)
+				{
+					state->release();
+					throw;
+				}
+			}
+	};
+
+	class thread_pool {
+		private:
+			std::vector<std::unique_ptr<detail::work_stealing_deque>> _deques;
+			std::vector<std::thread>				  _threads;
+			std::mutex						  _mutex;
+			std::condition_variable					  _wake;
+			std::deque<detail::pool_task*>				  _injected;
+			std::atomic<std::size_t>				  _injected_count;
+			std::atomic<std::size_t>				  _pending;
+			std::atomic<std::size_t>				  _sleeping;
+			std::atomic<bool>					  _stop;
+
+			bool is_worker() const noexcept
+			{
+				return detail::worker_context::local().pool == this;
+			}
+
+			void push(detail::pool_task* task)
+			{
+				if (this->is_worker())
+				{
+					_deques[detail::worker_context::local().index]->push(task);
+				}
+				else
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					_injected.push_back(task);
+					_injected_count.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				_pending.fetch_add(1, std::memory_order_seq_cst);
+				if (_sleeping.load(std::memory_order_seq_cst) != 0)
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					_wake.notify_one();
+				}
+			}
+
+			detail::pool_task* find_task()
+			{
+				detail::pool_task* task = nullptr;
+				std::size_t	   start = 0;
+				if (this->is_worker())
+				{
+					start = detail::worker_context::local().index;
+					task  = _deques[start]->pop();
+				}
+
+				if (task == nullptr && _injected_count.load(std::memory_order_relaxed) != 0)
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					if (not _injected.empty())
+					{
+						task = _injected.front();
+						_injected.pop_front();
+						_injected_count.fetch_sub(1, std::memory_order_relaxed);
+					}
+				}
+
+				for (std::size_t i = 1; task == nullptr && i <= _deques.size(); i++)
+					task = _deques[(start + i) % _deques.size()]->steal();
+
+				if (task != nullptr)
+					_pending.fetch_sub(1, std::memory_order_relaxed);
+				return task;
+			}
+
+			void worker_loop(std::size_t index)
+			{
+				detail::worker_context::local().pool  = this;
+				detail::worker_context::local().index = index;
+
+				for (;;)
+				{
+					if (this->run_one())
+						continue;
+
+					std::unique_lock<std::mutex> lock(_mutex);
+					_sleeping.fetch_add(1, std::memory_order_seq_cst);
+					while (_pending.load(std::memory_order_seq_cst) == 0 && not _stop.load(std::memory_order_relaxed))
+						_wake.wait(lock);
+					_sleeping.fetch_sub(1, std::memory_order_relaxed);
+					if (_stop.load(std::memory_order_relaxed) && _pending.load(std::memory_order_seq_cst) == 0)
+						break;
+				}
+			}
+
+		public:
+			explicit thread_pool(std::size_t threads = std::thread::hardware_concurrency())
+			    : _injected_count(0), _pending(0), _sleeping(0), _stop(false)
+			{
+				if (threads == 0)
+					threads = 1;
+				for (std::size_t i = 0; i < threads; i++)
+					_deques.emplace_back(new detail::work_stealing_deque());
+				for (std::size_t i = 0; i < threads; i++)
+					_threads.emplace_back([this, i] { this->worker_loop(i); });
+			}
+
+			thread_pool(const thread_pool&) = delete;
+			thread_pool& operator=(const thread_pool&) = delete;
+
+			~thread_pool()
+			{
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					_stop.store(true, std::memory_order_relaxed);
+				}
+				_wake.notify_all();
+				for (auto& thread : _threads)
+					thread.join();
+			}
+
+			std::size_t size() const noexcept
+			{
+				return _threads.size();
+			}
+
+			bool run_one()
+			{
+				detail::pool_task* task = this->find_task();
+				if (task == nullptr)
+					return false;
+				task->_execute(task);
+				return true;
+			}
+
+			// fire and forget; an exception thrown by f is discarded, use submit to observe it
+			template<class F>
+			void post(F&& f)
+			{
+				this->push(detail::function_task<typename std::decay<F>::type>::create(std::forward<F>(f)));
+			}
+
+			template<class F, class Result = typename std::decay<decltype(std::declval<F&>()())>::type>
+			expected_future<typename Result::value_type, typename Result::error_type> submit(F&& f)
+			{
+				using value_type = typename Result::value_type;
+				using error_type = typename Result::error_type;
+				using task_type	 = detail::future_task<typename std::decay<F>::type, value_type, error_type>;
+
+				task_type* task = task_type::create(std::forward<F>(f));
+				this->push(task);
+				return expected_future<value_type, error_type>(task);
+			}
+
+			static thread_pool* current() noexcept
+			{
+				return detail::worker_context::local().pool;
+			}
+	};
+
+	template<class T, class E>
+	void expected_future<T, E>::wait() const
+	{
+		thread_pool* pool = thread_pool::current();
+		if (pool == nullptr)
+		{
+			_state->wait();
+			return;
+		}
+
+		detail::backoff delay;
+		while (not _state->ready())
+		{
+			if (not pool->run_one())
+				delay.pause();
+		}
+	}
+
+	template<class T, class E>
+	expected<std::vector<T>, E> when_all(std::vector<expected_future<T, E>> futures)
+	{
+		std::vector<T> values;
+		values.reserve(futures.size());
+		for (auto& future : futures)
+		{
+			expected<T, E> result = future.get();
+			if (not result.has_value())
+				return expected<std::vector<T>, E>(std::move(result).error() _location_with(result.error_location()));
+			values.push_back(*std::move(result));
+		}
+		return expected<std::vector<T>, E>(std::move(values));
+	}
+
+	template<class T, class E>
+	std::pair<std::size_t, expected<T, E>> when_any(std::vector<expected_future<T, E>>& futures)
+	{
+		bool any_valid = false;
+		for (const auto& future : futures)
+			any_valid = any_valid || future.valid();
+		if (not any_valid)
+		{
+			throw std::runtime_error("Attempted to wait for any of an empty set of futures");
+		}
+
+		// the caller sleeps on one signal that every future notifies, a worker keeps running pool
+		// tasks and only naps when there is nothing to run, since new tasks do not wake it
+		thread_pool*		   pool	  = thread_pool::current();
+		detail::completion_signal* signal = new detail::completion_signal();
+		std::size_t		   first  = futures.size();
+		for (std::size_t i = 0; i < futures.size() && first == futures.size(); i++)
+		{
+			if (futures[i].valid() && futures[i]._state->watch(signal))
+				first = i;
+		}
+
+		while (first == futures.size())
+		{
+			if (pool == nullptr)
+				signal->wait_for(std::chrono::microseconds(0));
+			else if (not pool->run_one())
+				signal->wait_for(std::chrono::microseconds(200));
+
+			for (std::size_t i = 0; i < futures.size() && first == futures.size(); i++)
+			{
+				if (futures[i].ready())
+					first = i;
+			}
+		}
+
+		for (auto& future : futures)
+		{
+			if (future.valid())
+				future._state->unwatch();
+		}
+		signal->release();
+		return std::pair<std::size_t, expected<T, E>>(first, futures[first].get());
+	}
+
+	namespace detail {
+		// runs on the calling thread plus up to workers - 1 tasks posted to the pool, and helps
+		// drain the pool while the posted tasks finish so that nested calls from a worker cannot
+		// deadlock
+		template<class Range, class F, class Result = typename transform_result<Range, F>::type>
+		expected<std::vector<typename Result::value_type>, typename Result::error_type> parallel_transform(
+		    Range&& range, F& f, thread_pool& pool, std::size_t workers)
+		{
+			using iterator	 = decltype(std::begin(range));
+			using value_type = typename Result::value_type;
+			using error_type = typename Result::error_type;
+			static_assert(std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<iterator>::iterator_category>::value,
+			    "parallel_transform requires a random access range");
+			static_assert(std::is_default_constructible<value_type>::value, "the mapped value type must be default constructible");
+
+			iterator    first = std::begin(range);
+			std::size_t count = static_cast<std::size_t>(std::distance(first, std::end(range)));
+			if (workers == 0)
+				workers = 1;
+			if (workers > count)
+				workers = count == 0 ? 1 : count;
+
+			typename transform_buffer<value_type>::type out(count);
+			std::size_t chunk = count / (workers * 8);
+			parallel_transform_state<iterator, F, value_type, error_type> state(first, count, chunk == 0 ? 1 : chunk, f, out);
+
+			std::atomic<std::size_t> remaining(0);
+			for (std::size_t i = 1; i < workers && i < state.chunks(); i++)
+			{
+				remaining.fetch_add(1, std::memory_order_relaxed);
+				try
+				{
+					pool.post(
+					    [&state, &remaining]
+					    {
+						    state.run();
+						    remaining.fetch_sub(1, std::memory_order_release);
+					    });
+				}
+				catch (...)
+				{
+					// a task that failed to post never runs, and the tasks already posted still
+					// reference this frame; the calling thread takes the chunks left unclaimed
+					remaining.fetch_sub(1, std::memory_order_relaxed);
+					break;
+				}
+			}
+			state.run();
+
+			backoff delay;
+			while (remaining.load(std::memory_order_acquire) != 0)
+			{
+				if (not pool.run_one())
+					delay.pause();
+			}
+
+			return state.result();
+		}
+
+		// shared by every parallel_transform call that is not given a pool, so the threads are
+		// started once per process rather than once per call
+		inline thread_pool& default_pool()
+		{
+			static thread_pool pool(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 1);
+			return pool;
+		}
+	}
+
+	template<class Range, class F, class Result = typename detail::transform_result<Range, F>::type>
+	expected<std::vector<typename Result::value_type>, typename Result::error_type> parallel_transform(
+	    Range&& range, F f, thread_pool& pool)
+	{
+		return detail::parallel_transform(std::forward<Range>(range), f, pool, pool.size() + 1);
+	}
+
+	template<class Range, class F, class Result = typename detail::transform_result<Range, F>::type>
+	expected<std::vector<typename Result::value_type>, typename Result::error_type> parallel_transform(
+	    Range&& range, F f, std::size_t workers = std::thread::hardware_concurrency())
+	{
+		thread_pool& pool = detail::default_pool();
+		if (workers > pool.size() + 1)
+			workers = pool.size() + 1;
+		return detail::parallel_transform(std::forward<Range>(range), f, pool, workers);
+	}
+
+#if defined(_source_location)
+	}
+#endif
+}
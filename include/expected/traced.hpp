@@ -0,0 +1,212 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <expected/detail/error_message.hpp>
+#include <cstdio>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+#define _frame_walk
+#include <pthread.h>
+#include <dlfcn.h>
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	namespace detail {
+#if defined(_frame_walk)
+		struct stack_bounds {
+				std::uintptr_t low;
+				std::uintptr_t high;
+
+				static const stack_bounds& local() noexcept
+				{
+					static thread_local stack_bounds bounds = current();
+					return bounds;
+				}
+
+				static stack_bounds current() noexcept
+				{
+					stack_bounds   bounds = {0, 0};
+					pthread_attr_t attributes;
+					if (pthread_getattr_np(pthread_self(), &attributes) != 0)
+						return bounds;
+					void*	    address = nullptr;
+					std::size_t size    = 0;
+					if (pthread_attr_getstack(&attributes, &address, &size) == 0)
+					{
+						bounds.low  = reinterpret_cast<std::uintptr_t>(address);
+						bounds.high = bounds.low + size;
+					}
+					pthread_attr_destroy(&attributes);
+					return bounds;
+				}
+		};
+
+		struct stack_frame {
+				const stack_frame* next;
+				void*		   return_address;
+		};
+
+		__attribute__((noinline)) inline std::uint32_t capture_frames(void** frames, std::size_t capacity) noexcept
+		{
+			const stack_bounds& bounds = stack_bounds::local();
+			const stack_frame*  frame  = static_cast<const stack_frame*>(__builtin_frame_address(0));
+			std::uint32_t	    size   = 0;
+			while (size < capacity)
+			{
+				std::uintptr_t address = reinterpret_cast<std::uintptr_t>(frame);
+				if (address < bounds.low || address + sizeof(stack_frame) > bounds.high || address % alignof(stack_frame) != 0)
+					break;
+				if (frame->return_address == nullptr)
+					break;
+				frames[size++] = frame->return_address;
+				if (frame->next <= frame)
+					break;
+				frame = frame->next;
+			}
+			return size;
+		}
+
+		inline void describe_frame(std::string& out, const void* address)
+		{
+			char buffer[32];
+			int  length = std::snprintf(buffer, sizeof(buffer), "%p", address);
+			out.append(buffer, static_cast<std::size_t>(length));
+
+			Dl_info info;
+			if (dladdr(address, &info) == 0)
+				return;
+			if (info.dli_sname != nullptr)
+			{
+				int   status	= 0;
+				char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+				out += ' ';
+				out += status == 0 && demangled != nullptr ? demangled : info.dli_sname;
+				std::free(demangled);
+				length = std::snprintf(buffer, sizeof(buffer), "+0x%zx",
+				    static_cast<std::size_t>(static_cast<const char*>(address) - static_cast<const char*>(info.dli_saddr)));
+				out.append(buffer, static_cast<std::size_t>(length));
+			}
+			if (info.dli_fname != nullptr)
+			{
+				out += " (";
+				out += info.dli_fname;
+				out += ')';
+			}
+		}
+#else
+		inline std::uint32_t capture_frames(void**, std::size_t) noexcept
+		{
+			return 0;
+		}
+
+		inline void describe_frame(std::string& out, const void* address)
+		{
+			char buffer[32];
+			int  length = std::snprintf(buffer, sizeof(buffer), "%p", address);
+			out.append(buffer, static_cast<std::size_t>(length));
+		}
+#endif
+	}
+
+	template<class E, std::size_t Depth = 16>
+	class traced {
+		private:
+			// the frames come first so that they are zeroed before the capture fills them, and a
+			// copy never reads the unused tail uninitialized
+			E	      _error;
+			void*	      _frames[Depth];
+			std::uint32_t _size;
+
+		public:
+			using element_type = E;
+
+			traced(const E& error) : _error(error), _frames(), _size(detail::capture_frames(_frames, Depth))
+			{
+			}
+
+			traced(E&& error) : _error(std::move(error)), _frames(), _size(detail::capture_frames(_frames, Depth))
+			{
+			}
+
+			const E& get() const noexcept
+			{
+				return _error;
+			}
+
+			const E& operator*() const noexcept
+			{
+				return _error;
+			}
+
+			const E* operator->() const noexcept
+			{
+				return std::addressof(_error);
+			}
+
+			std::size_t depth() const noexcept
+			{
+				return _size;
+			}
+
+			void* frame(std::size_t index) const noexcept
+			{
+				return _frames[index];
+			}
+
+			std::string backtrace() const
+			{
+				std::string out;
+				for (std::uint32_t i = 0; i < _size; i++)
+				{
+					out += '#';
+					out += std::to_string(i);
+					out += ' ';
+					detail::describe_frame(out, _frames[i]);
+					out += '\n';
+				}
+				return out;
+			}
+
+			std::string message() const
+			{
+				std::string out = detail::error_message(_error, detail::priority<4>());
+				if (_size != 0)
+				{
+					out += '\n';
+					out += this->backtrace();
+				}
+				return out;
+			}
+
+			friend bool operator==(const traced& lhs, const traced& rhs)
+			{
+				return lhs._error == rhs._error;
+			}
+
+			friend bool operator!=(const traced& lhs, const traced& rhs)
+			{
+				return not(lhs._error == rhs._error);
+			}
+	};
+
+	namespace detail {
+		template<class E, std::size_t Depth>
+		struct is_error_wrapper<traced<E, Depth>> : std::true_type {};
+	}
+
+#if defined(_source_location)
+	}
+#endif
+}
@@ -0,0 +1,424 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <expected/sequence.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+	class monotonic_arena {
+		private:
+			struct chunk {
+					chunk*	    next;
+					std::size_t size;
+			};
+
+			unsigned char* _buffer;
+			std::size_t    _buffer_size;
+			unsigned char* _cursor;
+			unsigned char* _limit;
+			chunk*	       _chunks;
+			std::size_t    _next_size;
+
+			void grow(std::size_t size, std::size_t alignment)
+			{
+				std::size_t needed = sizeof(chunk) + size + alignment;
+				std::size_t bytes  = _next_size < needed ? needed : _next_size;
+				chunk*	    block  = static_cast<chunk*>(::operator new(bytes));
+				block->next	   = _chunks;
+				block->size	   = bytes;
+				_chunks		   = block;
+				_cursor		   = reinterpret_cast<unsigned char*>(block + 1);
+				_limit		   = reinterpret_cast<unsigned char*>(block) + bytes;
+				_next_size	   = bytes * 2;
+			}
+
+		public:
+			monotonic_arena() noexcept
+			    : _buffer(nullptr), _buffer_size(0), _cursor(nullptr), _limit(nullptr), _chunks(nullptr), _next_size(1024)
+			{
+			}
+
+			monotonic_arena(void* buffer, std::size_t size) noexcept
+			    : _buffer(static_cast<unsigned char*>(buffer)), _buffer_size(size), _cursor(_buffer), _limit(_buffer + size),
+				_chunks(nullptr), _next_size(size < 1024 ? 1024 : size)
+			{
+			}
+
+			monotonic_arena(const monotonic_arena&) = delete;
+			monotonic_arena& operator=(const monotonic_arena&) = delete;
+
+			~monotonic_arena()
+			{
+				this->release();
+			}
+
+			void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+			{
+				if (alignment > alignof(std::max_align_t))
+				{
+					throw std::runtime_error("monotonic_arena does not support over-aligned allocations");
+				}
+
+				std::size_t pad = static_cast<std::size_t>(-reinterpret_cast<std::uintptr_t>(_cursor)) & (alignment - 1);
+				if (_cursor == nullptr || static_cast<std::size_t>(_limit - _cursor) < pad + size)
+				{
+					this->grow(size, alignment);
+					pad = static_cast<std::size_t>(-reinterpret_cast<std::uintptr_t>(_cursor)) & (alignment - 1);
+				}
+
+				void* memory = _cursor + pad;
+				_cursor += pad + size;
+				return memory;
+			}
+
+			void release() noexcept
+			{
+				while (_chunks != nullptr)
+				{
+					chunk* next = _chunks->next;
+					::operator delete(_chunks);
+					_chunks = next;
+				}
+				_cursor = _buffer;
+				_limit	= _buffer + _buffer_size;
+			}
+	};
+
+	template<class E>
+	class error_list {
+		private:
+			struct node {
+					node* next;
+					E     error;
+
+					template<class... Args>
+					explicit node(Args&&... args) : next(nullptr), error(std::forward<Args>(args)...)
+					{
+					}
+			};
+
+			monotonic_arena* _arena;
+			node*		 _head;
+			node*		 _tail;
+			std::size_t	 _size;
+
+			void destroy() noexcept
+			{
+				for (node* current = _head; current != nullptr;)
+				{
+					node* next = current->next;
+					current->~node();
+					current = next;
+				}
+				_head = _tail = nullptr;
+				_size	      = 0;
+			}
+
+		public:
+			class const_iterator {
+				private:
+					const node* _current;
+
+				public:
+					using iterator_category = std::forward_iterator_tag;
+					using value_type	= E;
+					using difference_type	= std::ptrdiff_t;
+					using pointer		= const E*;
+					using reference		= const E&;
+
+					explicit const_iterator(const node* current = nullptr) noexcept : _current(current)
+					{
+					}
+
+					const E& operator*() const noexcept
+					{
+						return _current->error;
+					}
+
+					const E* operator->() const noexcept
+					{
+						return std::addressof(_current->error);
+					}
+
+					const_iterator& operator++() noexcept
+					{
+						_current = _current->next;
+						return *this;
+					}
+
+					const_iterator operator++(int) noexcept
+					{
+						const_iterator copy = *this;
+						_current	    = _current->next;
+						return copy;
+					}
+
+					bool operator==(const const_iterator& other) const noexcept
+					{
+						return _current == other._current;
+					}
+
+					bool operator!=(const const_iterator& other) const noexcept
+					{
+						return _current != other._current;
+					}
+			};
+
+			explicit error_list(monotonic_arena& arena) noexcept : _arena(std::addressof(arena)), _head(nullptr), _tail(nullptr), _size(0)
+			{
+			}
+
+			error_list(const error_list&) = delete;
+			error_list& operator=(const error_list&) = delete;
+
+			error_list(error_list&& other) noexcept : _arena(other._arena), _head(other._head), _tail(other._tail), _size(other._size)
+			{
+				other._head = other._tail = nullptr;
+				other._size		  = 0;
+			}
+
+			error_list& operator=(error_list&& other) noexcept
+			{
+				if (this != &other)
+				{
+					this->destroy();
+					_arena	    = other._arena;
+					_head	    = other._head;
+					_tail	    = other._tail;
+					_size	    = other._size;
+					other._head = other._tail = nullptr;
+					other._size		  = 0;
+				}
+				return *this;
+			}
+
+			~error_list()
+			{
+				this->destroy();
+			}
+
+			template<class... Args>
+			E& emplace_back(Args&&... args)
+			{
+				void* memory  = _arena->allocate(sizeof(node), alignof(node));
+				node* created = new (memory) node(std::forward<Args>(args)...);
+				if (_tail != nullptr)
+					_tail->next = created;
+				else
+					_head = created;
+				_tail = created;
+				_size++;
+				return created->error;
+			}
+
+			void push_back(const E& error)
+			{
+				this->emplace_back(error);
+			}
+
+			void push_back(E&& error)
+			{
+				this->emplace_back(std::move(error));
+			}
+
+			void splice(error_list&& other)
+			{
+				if (_arena != other._arena)
+				{
+					throw std::runtime_error("Attempted to splice error lists from different arenas");
+				}
+				if (other._head == nullptr)
+					return;
+				if (_tail != nullptr)
+					_tail->next = other._head;
+				else
+					_head = other._head;
+				_tail	     = other._tail;
+				_size	    += other._size;
+				other._head  = other._tail = nullptr;
+				other._size  = 0;
+			}
+
+			monotonic_arena& arena() const noexcept
+			{
+				return *_arena;
+			}
+
+			std::size_t size() const noexcept
+			{
+				return _size;
+			}
+
+			bool empty() const noexcept
+			{
+				return _size == 0;
+			}
+
+			const E& front() const noexcept
+			{
+				return _head->error;
+			}
+
+			const_iterator begin() const noexcept
+			{
+				return const_iterator(_head);
+			}
+
+			const_iterator end() const noexcept
+			{
+				return const_iterator(nullptr);
+			}
+	};
+
+	template<class T, class E>
+	class validated {
+		private:
+			error_list<E> _errors;
+			bool	      _has_value;
+
+			union {
+					T _value;
+			};
+
+		public:
+			validated(monotonic_arena& arena, const T& value) : _errors(arena), _has_value(true)
+			{
+				new (std::addressof(_value)) T(value);
+			}
+
+			validated(monotonic_arena& arena, T&& value) : _errors(arena), _has_value(true)
+			{
+				new (std::addressof(_value)) T(std::move(value));
+			}
+
+			explicit validated(error_list<E>&& errors) : _errors(std::move(errors)), _has_value(_errors.empty())
+			{
+				if (_has_value)
+				{
+					throw std::runtime_error("Attempted to construct an invalid state from an empty error list");
+				}
+			}
+
+			validated(validated&& other) : _errors(std::move(other._errors)), _has_value(other._has_value)
+			{
+				if (_has_value)
+					new (std::addressof(_value)) T(std::move(other._value));
+			}
+
+			validated(const validated&) = delete;
+			validated& operator=(const validated&) = delete;
+
+			~validated()
+			{
+				if (_has_value)
+					_value.~T();
+			}
+
+			bool has_value() const noexcept
+			{
+				return _has_value;
+			}
+
+			explicit operator bool() const noexcept
+			{
+				return _has_value;
+			}
+
+			const T& value() const&
+			{
+				if (not _has_value)
+				{
+					throw std::runtime_error("Attempted to access the value of a error state");
+				}
+				return _value;
+			}
+
+			T& value() &
+			{
+				if (not _has_value)
+				{
+					throw std::runtime_error("Attempted to access the value of a error state");
+				}
+				return _value;
+			}
+
+			T&& value() &&
+			{
+				if (not _has_value)
+				{
+					throw std::runtime_error("Attempted to access the value of a error state");
+				}
+				return std::move(_value);
+			}
+
+			const error_list<E>& errors() const noexcept
+			{
+				return _errors;
+			}
+
+			template<class... Args>
+			void add_error(Args&&... args)
+			{
+				_errors.emplace_back(std::forward<Args>(args)...);
+				if (_has_value)
+				{
+					_value.~T();
+					_has_value = false;
+				}
+			}
+
+			template<class U>
+			void merge(validated<U, E>&& other)
+			{
+				if (other.has_value())
+					return;
+				_errors.splice(std::move(other)._errors);
+				if (_has_value)
+				{
+					_value.~T();
+					_has_value = false;
+				}
+			}
+
+			template<class U, class G>
+			friend class validated;
+	};
+
+#if __cplusplus >= 201703L
+	template<class F, class... Results, class E = typename detail::sequence_error<Results...>::type>
+	auto validate(monotonic_arena& arena, F&& f, Results&&... results)
+	    -> validated<std::remove_cv_t<std::remove_reference_t<std::invoke_result_t<F, decltype(*std::forward<Results>(results))...>>>, E>
+	{
+		using mapped = std::remove_cv_t<std::remove_reference_t<std::invoke_result_t<F, decltype(*std::forward<Results>(results))...>>>;
+
+		if (detail::all_present(results...))
+			return validated<mapped, E>(arena, std::invoke(std::forward<F>(f), *std::forward<Results>(results)...));
+
+		error_list<E> errors(arena);
+		(
+		    [&](auto&& result)
+		    {
+			    if (not result.has_value())
+				    errors.emplace_back(detail::expected_access::error(std::forward<decltype(result)>(result)));
+		    }(std::forward<Results>(results)),
+		    ...);
+		return validated<mapped, E>(std::move(errors));
+	}
+#endif
+
+#if defined(_source_location)
+	}
+#endif
+}
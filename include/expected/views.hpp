@@ -0,0 +1,282 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ */
+
+#pragma once
+
+#include <expected.hpp>
+#include <functional>
+#include <iterator>
+
+#if __cplusplus >= 202002L
+#include <ranges>
+#include <optional>
+#endif
+
+namespace nl {
+#if defined(_source_location)
+	inline namespace located _abi_tag {
+#endif
+
+#if defined(__cpp_lib_ranges)
+	namespace detail {
+		template<class Derived>
+		struct range_pipe {
+				template<std::ranges::viewable_range R>
+				friend constexpr auto operator|(R&& range, const Derived& adaptor)
+				{
+					return adaptor(std::forward<R>(range));
+				}
+		};
+
+		template<class Reference, bool Values>
+		struct discriminant_projection {
+				using result   = std::remove_cvref_t<Reference>;
+				using selected = std::conditional_t<Values, typename result::value_type, typename result::error_type>;
+				using type     = std::conditional_t<std::is_reference_v<Reference>,
+				    std::conditional_t<Values, decltype(*std::declval<Reference>()), decltype(expected_access::error(std::declval<Reference>()))>,
+				    selected>;
+
+				static constexpr type project(Reference&& reference)
+				{
+					if constexpr (Values)
+						return static_cast<type>(*std::forward<Reference>(reference));
+					else
+						return static_cast<type>(expected_access::error(std::forward<Reference>(reference)));
+				}
+		};
+
+		template<std::ranges::view V, bool Values>
+		class discriminant_view : public std::ranges::view_interface<discriminant_view<V, Values>> {
+			private:
+				using projection = discriminant_projection<std::ranges::range_reference_t<V>, Values>;
+
+				// begin() is cached like std::ranges::filter_view does, so repeated calls stay amortized
+				// O(1); copies and moves start with an empty cache since the position belongs to _base
+				struct begin_cache {
+						std::optional<std::ranges::iterator_t<V>> position;
+
+						begin_cache() = default;
+
+						constexpr begin_cache(const begin_cache&) noexcept
+						{
+						}
+
+						constexpr begin_cache(begin_cache&& other) noexcept
+						{
+							other.position.reset();
+						}
+
+						constexpr begin_cache& operator=(const begin_cache& other) noexcept
+						{
+							if (this != &other)
+								position.reset();
+							return *this;
+						}
+
+						constexpr begin_cache& operator=(begin_cache&& other) noexcept
+						{
+							position.reset();
+							other.position.reset();
+							return *this;
+						}
+				};
+
+				V	    _base;
+				begin_cache _begin;
+
+			public:
+				class iterator {
+					private:
+						friend discriminant_view;
+
+						std::ranges::iterator_t<V> _current;
+						std::ranges::sentinel_t<V> _end;
+
+						constexpr void satisfy()
+						{
+							while (_current != _end && (*_current).has_value() != Values)
+								++_current;
+						}
+
+					public:
+						using iterator_concept = std::conditional_t<std::ranges::forward_range<V>, std::forward_iterator_tag, std::input_iterator_tag>;
+						using value_type       = std::remove_cvref_t<typename projection::type>;
+						using difference_type  = std::ranges::range_difference_t<V>;
+
+						iterator() = default;
+
+						constexpr iterator(std::ranges::iterator_t<V> current, std::ranges::sentinel_t<V> end)
+						    : _current(std::move(current)), _end(std::move(end))
+						{
+							this->satisfy();
+						}
+
+						constexpr typename projection::type operator*() const
+						{
+							return projection::project(*_current);
+						}
+
+						constexpr iterator& operator++()
+						{
+							++_current;
+							this->satisfy();
+							return *this;
+						}
+
+						constexpr void operator++(int)
+						    requires(not std::ranges::forward_range<V>)
+						{
+							++*this;
+						}
+
+						constexpr iterator operator++(int)
+						    requires std::ranges::forward_range<V>
+						{
+							iterator copy = *this;
+							++*this;
+							return copy;
+						}
+
+						friend constexpr bool operator==(const iterator& lhs, const iterator& rhs)
+						    requires std::equality_comparable<std::ranges::iterator_t<V>>
+						{
+							return lhs._current == rhs._current;
+						}
+
+						friend constexpr bool operator==(const iterator& it, std::default_sentinel_t)
+						{
+							return it._current == it._end;
+						}
+				};
+
+				discriminant_view() = default;
+
+				constexpr explicit discriminant_view(V base) : _base(std::move(base))
+				{
+				}
+
+				constexpr V base() const&
+				    requires std::copy_constructible<V>
+				{
+					return _base;
+				}
+
+				constexpr V base() &&
+				{
+					return std::move(_base);
+				}
+
+				constexpr iterator begin()
+				{
+					if constexpr (std::ranges::forward_range<V>)
+					{
+						if (_begin.position)
+							return iterator(*_begin.position, std::ranges::end(_base));
+						iterator first(std::ranges::begin(_base), std::ranges::end(_base));
+						_begin.position = first._current;
+						return first;
+					}
+					else
+					{
+						return iterator(std::ranges::begin(_base), std::ranges::end(_base));
+					}
+				}
+
+				constexpr std::default_sentinel_t end() const noexcept
+				{
+					return std::default_sentinel;
+				}
+		};
+
+		template<bool Values>
+		struct discriminant_adaptor : range_pipe<discriminant_adaptor<Values>> {
+				template<std::ranges::viewable_range R>
+				constexpr auto operator()(R&& range) const
+				{
+					return discriminant_view<std::views::all_t<R>, Values>(std::views::all(std::forward<R>(range)));
+				}
+		};
+
+		struct has_value_predicate {
+				template<class Result>
+				constexpr bool operator()(const Result& result) const noexcept
+				{
+					return result.has_value();
+				}
+		};
+
+		struct take_while_ok_adaptor : range_pipe<take_while_ok_adaptor> {
+				template<std::ranges::viewable_range R>
+				constexpr auto operator()(R&& range) const
+				{
+					return std::views::take_while(std::forward<R>(range), has_value_predicate());
+				}
+		};
+
+		template<class F, bool Flatten>
+		struct map_ok_function {
+				F f;
+
+				template<class Reference>
+				constexpr auto operator()(Reference&& reference) const
+				{
+					using result	 = std::remove_cvref_t<Reference>;
+					using error_type = typename result::error_type;
+					using mapped	 = std::remove_cvref_t<std::invoke_result_t<const F&, decltype(*std::forward<Reference>(reference))>>;
+					using output	 = std::conditional_t<Flatten, mapped, expected<mapped, error_type>>;
+
+					if (reference.has_value())
+						return output(std::invoke(f, *std::forward<Reference>(reference)));
+					else
+						return output(error_type(expected_access::error(std::forward<Reference>(reference)))
+							_location_with(reference.error_location()));
+				}
+		};
+
+		template<class F, bool Flatten>
+		struct map_ok_closure : range_pipe<map_ok_closure<F, Flatten>> {
+				F f;
+
+				constexpr explicit map_ok_closure(F function) : f(std::move(function))
+				{
+				}
+
+				template<std::ranges::viewable_range R>
+				constexpr auto operator()(R&& range) const
+				{
+					return std::views::transform(std::forward<R>(range), map_ok_function<F, Flatten>{f});
+				}
+		};
+
+		template<bool Flatten>
+		struct map_ok_adaptor {
+				template<class F>
+				constexpr auto operator()(F f) const
+				{
+					return map_ok_closure<F, Flatten>(std::move(f));
+				}
+
+				template<std::ranges::viewable_range R, class F>
+				constexpr auto operator()(R&& range, F f) const
+				{
+					return map_ok_closure<F, Flatten>(std::move(f))(std::forward<R>(range));
+				}
+		};
+	}
+
+	namespace views {
+		inline constexpr detail::discriminant_adaptor<true>  values;
+		inline constexpr detail::discriminant_adaptor<false> errors;
+		inline constexpr detail::take_while_ok_adaptor	     take_while_ok;
+		inline constexpr detail::map_ok_adaptor<false>	     transform_ok;
+		inline constexpr detail::map_ok_adaptor<true>	     and_then;
+	}
+#endif
+
+#if defined(_source_location)
+	}
+#endif
+}
@@ -1,17 +1,99 @@
 /*
  * Copyright: 2025 nodeluna
  * SPDX-License-Identifier: Apache-2.0
- * repository: https://github.com/nodeluna/ljson
+ * repository: https://github.com/nodeluna/expected
  */
 
 module;
 
 #include <expected.hpp>
+#include <expected/algorithm.hpp>
+#include <expected/atomic_expected.hpp>
+#include <expected/boxed.hpp>
+#include <expected/context_error.hpp>
+#include <expected/coroutine.hpp>
+#include <expected/erased_error.hpp>
+#include <expected/error_pool.hpp>
+#include <expected/expected_vector.hpp>
+#include <expected/format_error.hpp>
+#include <expected/interner.hpp>
+#include <expected/pmr.hpp>
+#include <expected/scan.hpp>
+#include <expected/sequence.hpp>
+#include <expected/shared_error.hpp>
+#include <expected/status_code.hpp>
+#include <expected/thread_pool.hpp>
+#include <expected/traced.hpp>
+#include <expected/validated.hpp>
+#include <expected/views.hpp>
 
 export module nl.expected;
 
 export namespace nl {
-	using ljson::expected;
-	using ljson::unexpected;
-	using ljson::monostate;
+	using nl::expected;
+	using nl::unexpected;
+	using nl::monostate;
+	using nl::values_or;
+	using nl::expected_vector;
+	using nl::any_error;
+	using nl::count_errors;
+	using nl::first_error_index;
+	using nl::error_indices;
+	using nl::partition_results;
+	using nl::collect;
+	using nl::parallel_transform;
+	using nl::thread_pool;
+	using nl::expected_future;
+	using nl::when_all;
+	using nl::when_any;
+	using nl::atomic_expected;
+	using nl::boxed;
+	using nl::boxed_if_large;
+	using nl::error_pool_stats;
+	using nl::error_pool_statistics;
+	using nl::erased_error;
+	using nl::error_domain;
+	using nl::generic_domain;
+	using nl::system_domain;
+	using nl::unmapped_domain;
+	using nl::status_code;
+	using nl::from_errno;
+	using nl::from_error_code;
+	using nl::format_error;
+	using nl::make_format_error;
+	using nl::message_interner;
+	using nl::interned_error;
+	using nl::atomic_refcount;
+	using nl::local_refcount;
+	using nl::shared_error;
+	using nl::context_frame;
+	using nl::context_error;
+	using nl::traced;
+#if __cplusplus >= 201703L
+	using nl::sequence;
+	using nl::apply_ok;
+	using nl::validate;
+#endif
+	using nl::monotonic_arena;
+	using nl::error_list;
+	using nl::validated;
+#if defined(__cpp_lib_memory_resource)
+	namespace pmr {
+		using nl::pmr::expected;
+		using nl::pmr::unexpected;
+	}
+#endif
+#if defined(__cpp_impl_coroutine)
+	using nl::expected_task;
+	using nl::expected_generator;
+#endif
+#if defined(__cpp_lib_ranges)
+	namespace views {
+		using nl::views::values;
+		using nl::views::errors;
+		using nl::views::take_while_ok;
+		using nl::views::transform_ok;
+		using nl::views::and_then;
+	}
+#endif
 }
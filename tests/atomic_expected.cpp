@@ -0,0 +1,92 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O1 -g -fsanitize=thread -I include tests/atomic_expected.cpp && ./a.out
+ */
+
+#include <expected/atomic_expected.hpp>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main()
+{
+	constexpr int rounds  = 500;
+	constexpr int writers = 4;
+	constexpr int readers = 4;
+
+	for (int round = 0; round < rounds; round++)
+	{
+		nl::atomic_expected<std::string, int> slot;
+		std::atomic<int>		      winners(0);
+		std::atomic<int>		      winner_id(-1);
+		std::atomic<bool>		      start(false);
+		std::vector<std::string>	      seen(readers);
+
+		std::vector<std::thread> threads;
+		for (int id = 0; id < writers; id++)
+		{
+			threads.emplace_back(
+			    [&, id]
+			    {
+				    while (not start.load(std::memory_order_acquire))
+					    std::this_thread::yield();
+
+				    bool won = id % 2 == 0 ? slot.set_value(std::to_string(id)) : slot.set_error(id);
+				    if (won)
+				    {
+					    winners.fetch_add(1, std::memory_order_relaxed);
+					    winner_id.store(id, std::memory_order_relaxed);
+				    }
+			    });
+		}
+
+		for (int id = 0; id < readers; id++)
+		{
+			threads.emplace_back(
+			    [&, id]
+			    {
+				    while (not start.load(std::memory_order_acquire))
+					    std::this_thread::yield();
+
+				    const nl::expected<std::string, int>& result = id % 2 == 0 ? slot.wait() : *[&]
+				    {
+					    const nl::expected<std::string, int>* published = nullptr;
+					    while ((published = slot.try_get()) == nullptr)
+						    std::this_thread::yield();
+					    return published;
+				    }();
+				    seen[id] = result.has_value() ? *result : "error " + std::to_string(result.error());
+			    });
+		}
+
+		start.store(true, std::memory_order_release);
+		for (auto& thread : threads)
+			thread.join();
+
+		assert(winners.load() == 1);
+		int id = winner_id.load();
+		std::string expected_text = id % 2 == 0 ? std::to_string(id) : "error " + std::to_string(id);
+		for (const auto& text : seen)
+			assert(text == expected_text);
+		assert(not slot.set_value("late"));
+	}
+
+	// a move-only payload is handed to its one consumer by take or by waiting on an rvalue
+	for (int round = 0; round < rounds; round++)
+	{
+		nl::atomic_expected<std::unique_ptr<int>, int> slot;
+		std::thread writer([&] { slot.set_value(std::unique_ptr<int>(new int(round))); });
+		nl::expected<std::unique_ptr<int>, int> taken = round % 2 == 0 ? slot.take() : std::move(slot).wait();
+		writer.join();
+		assert(taken.has_value() && **taken == round);
+		assert(slot.ready() && slot.try_get()->has_value() && **slot.try_get() == nullptr);
+	}
+
+	return 0;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++17 -O2 -I include tests/boxed.cpp && ./a.out
+ */
+
+#include <expected/boxed.hpp>
+#include <cassert>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+struct large_error {
+		int  code;
+		char detail[60];
+
+		friend bool operator==(const large_error& lhs, const large_error& rhs)
+		{
+			return lhs.code == rhs.code;
+		}
+};
+
+int main()
+{
+	static_assert(std::is_same<nl::boxed_if_large<large_error>, nl::boxed<large_error>>::value, "");
+	static_assert(std::is_same<nl::boxed_if_large<int>, int>::value, "");
+	static_assert(sizeof(nl::expected<int, nl::boxed<large_error>>) == sizeof(nl::expected<int, large_error*>), "");
+
+	// the error round-trips through the box, and expected accepts the unboxed type directly
+	nl::expected<int, nl::boxed<large_error>> failed = large_error{7, "disk"};
+	assert(not failed.has_value());
+	assert(failed.error()->code == 7 && std::string(failed.error()->detail) == "disk");
+	nl::expected<int, nl::boxed<large_error>> ok = 3;
+	assert(ok.value() == 3);
+
+	// copies are deep, moves hand the allocation over
+	nl::boxed<large_error> original(large_error{1, "a"});
+	nl::boxed<large_error> copy = original;
+	assert(copy == original && &*copy != &*original);
+	copy->code = 2;
+	assert(copy != original && original->code == 1);
+
+	const large_error*     address = &*original;
+	nl::boxed<large_error> moved   = std::move(original);
+	assert(&*moved == address);
+
+	// a moved-from box compares equal only to another empty box
+	nl::boxed<large_error> other_moved = std::move(copy);
+	assert(original == copy);
+	assert(not(original != copy));
+	assert(original != moved && moved != original);
+	assert(not(original == moved));
+
+	// assigning into a moved-from box refills it
+	original = moved;
+	assert(original == moved && &*original != &*moved);
+	copy = std::move(other_moved);
+	assert(copy->code == 2 && other_moved != copy);
+
+	return 0;
+}
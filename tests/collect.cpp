@@ -0,0 +1,78 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include tests/collect.cpp && ./a.out
+ */
+
+#include <expected/algorithm.hpp>
+#include <cassert>
+#include <iterator>
+#include <list>
+#include <ranges>
+#include <sstream>
+#include <span>
+#include <string>
+#include <vector>
+
+using result = nl::expected<std::string, int>;
+
+namespace {
+	// neither a std view nor a borrowed range, but it still refers to the caller's elements
+	struct wrapper {
+			std::vector<result>::iterator first;
+			std::vector<result>::iterator last;
+
+			std::vector<result>::iterator begin() const
+			{
+				return first;
+			}
+
+			std::vector<result>::iterator end() const
+			{
+				return last;
+			}
+	};
+}
+
+int main()
+{
+	std::vector<result> results;
+	results.emplace_back(std::string("alpha"));
+	results.emplace_back(std::string("beta"));
+	results.emplace_back(std::string("gamma"));
+
+	auto spanned = nl::collect<std::vector<std::string>>(std::span(results));
+	assert(spanned.has_value() && spanned->size() == 3);
+	assert(*results[0] == "alpha");
+
+	auto taken = nl::collect<std::list<std::string>>(results | std::views::take(2));
+	assert(taken.has_value() && taken->back() == "beta");
+	assert(*results[0] == "alpha" && *results[1] == "beta");
+
+	auto wrapped = nl::collect<std::vector<std::string>>(wrapper{results.begin(), results.end()});
+	assert(wrapped.has_value() && wrapped->back() == "gamma");
+	assert(*results[0] == "alpha" && *results[2] == "gamma");
+
+	auto moving = nl::collect<std::vector<std::string>>(
+	    std::ranges::subrange(std::make_move_iterator(results.begin()), std::make_move_iterator(results.begin() + 1)));
+	assert(moving.has_value() && moving->front() == "alpha");
+	assert(results[0]->empty());
+
+	results.emplace_back(7);
+	results.emplace_back(8);
+	auto failed = nl::collect<std::vector<std::string>>(results);
+	assert(not failed.has_value() && failed.error() == 7);
+
+	// an istream view reads an element on every begin(), so taking begin() twice would drop one
+	std::istringstream words("alpha beta gamma");
+	auto		   streamed = nl::collect<std::vector<std::string>>(
+	      std::views::istream<std::string>(words) | std::views::transform([](const std::string& word) { return result(word); }));
+	assert(streamed.has_value() && streamed->size() == 3 && streamed->front() == "alpha");
+
+	auto owned = nl::collect<std::vector<std::string>>(std::move(results));
+	assert(not owned.has_value() && owned.error() == 7);
+
+	return 0;
+}
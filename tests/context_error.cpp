@@ -0,0 +1,79 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include tests/context_error.cpp && ./a.out
+ */
+
+#include <expected/context_error.hpp>
+#include <cassert>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+template class nl::expected<int, std::string>;
+template class nl::expected<int, nl::context_error<std::errc>>;
+
+using result = nl::expected<int, nl::context_error<std::errc>>;
+
+namespace {
+	result open_file(bool fail)
+	{
+		if (fail)
+			return nl::context_error<std::errc>(std::errc::no_such_file_or_directory);
+		return 3;
+	}
+
+	result load(bool fail, int attempt)
+	{
+		return open_file(fail).context("while loading, attempt {}", attempt);
+	}
+}
+
+int main()
+{
+	result loaded = load(false, 1);
+	assert(loaded.has_value() && *loaded == 3);
+
+	result failed = load(true, 2);
+	assert(not failed.has_value());
+	assert(failed.error().root() == std::errc::no_such_file_or_directory);
+	assert(failed.error().depth() == 1);
+	assert(failed.error().frame(0).argument == 2);
+
+	failed.context("outer").context("outermost");
+
+	// a temporary annotated in place hands back its own value, so binding the result is safe
+	auto&& bound = open_file(true).context("bound");
+	static_assert(std::is_same<decltype(bound), result&&>::value, "");
+	assert(bound.error().depth() == 1 && bound.error().frame(0).argument == 0);
+	assert(failed.error().depth() == 3);
+
+	// frames render outermost first and an error-code enum root renders through its category
+	std::string no_such_file = std::make_error_code(std::errc::no_such_file_or_directory).message();
+	assert(failed.error().message() == "outermost: outer: while loading, attempt 2: " + no_such_file);
+
+	// a chain that spilled past its inline frames survives copies and moves
+	nl::context_error<std::errc, 2> spilled(std::errc::io_error);
+	for (int i = 0; i < 7; i++)
+		spilled.add_context("frame {}", i);
+	std::string rendered = spilled.message();
+	assert(rendered.rfind("frame 6: frame 5: ", 0) == 0);
+
+	nl::context_error<std::errc, 2> copied(spilled);
+	assert(copied.depth() == 7 && copied.frame(6).argument == 6 && copied.message() == rendered);
+	copied.add_context("frame {}", 7);
+	assert(copied.depth() == 8 && spilled.depth() == 7 && spilled.message() == rendered);
+
+	nl::context_error<std::errc, 2> moved(std::move(copied));
+	assert(moved.depth() == 8 && moved.frame(7).argument == 7 && copied.depth() == 0);
+
+	nl::context_error<std::errc, 2> assigned(std::errc::timed_out);
+	assigned = spilled;
+	assert(assigned.message() == rendered);
+	assigned = std::move(moved);
+	assert(assigned.depth() == 8 && assigned.message() == "frame 7: " + rendered);
+
+	return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++17 -O2 -I include tests/erased_error.cpp && ./a.out
+ */
+
+#include <expected/erased_error.hpp>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+struct parse_error {
+		int line;
+		int column;
+
+		std::string message() const
+		{
+			return "parse error at " + std::to_string(line) + ":" + std::to_string(column);
+		}
+
+		friend bool operator==(const parse_error& lhs, const parse_error& rhs)
+		{
+			return lhs.line == rhs.line && lhs.column == rhs.column;
+		}
+};
+
+struct wide_error {
+		char payload[128];
+		int  code;
+
+		friend bool operator==(const wide_error& lhs, const wide_error& rhs)
+		{
+			return lhs.code == rhs.code;
+		}
+};
+
+int main()
+{
+	// values never turn into errors implicitly, so a value convertible to T is a value
+	static_assert(not std::is_convertible<int, nl::erased_error>::value, "");
+	static_assert(not std::is_convertible<const char*, nl::erased_error>::value, "");
+	nl::expected<std::string, nl::erased_error> text("abc");
+	assert(text.has_value() && *text == "abc");
+	nl::expected<std::string, nl::erased_error> listed = {"def"};
+	assert(listed.has_value() && *listed == "def");
+
+	// errors enter through unexpected and keep their concrete type
+	nl::expected<std::string, nl::erased_error> failed = nl::unexpected(parse_error{3, 14});
+	assert(not failed.has_value());
+	assert(failed.error().is<parse_error>() && not failed.error().is<wide_error>());
+	assert(failed.error().get_if<parse_error>()->column == 14);
+	assert(failed.error().get_if<wide_error>() == nullptr);
+	assert(failed.error().message() == "parse error at 3:14");
+
+	// equality needs the same erased type and equal payloads
+	nl::erased_error first(parse_error{1, 2});
+	nl::erased_error same(parse_error{1, 2});
+	nl::erased_error other(parse_error{1, 3});
+	nl::erased_error code(std::errc::invalid_argument);
+	assert(first == same && first != other && first != code);
+	assert(nl::erased_error() == nl::erased_error() && first != nl::erased_error());
+
+	// copies and moves work for payloads inside the buffer and for boxed ones
+	nl::erased_error inline_copy = first;
+	assert(inline_copy == first);
+	nl::erased_error inline_moved = std::move(inline_copy);
+	assert(inline_moved == first && inline_copy.empty());
+
+	nl::erased_error wide(wide_error{{}, 42});
+	nl::erased_error wide_copy = wide;
+	assert(wide_copy == wide && wide_copy.get_if<wide_error>() != wide.get_if<wide_error>());
+	const wide_error* address    = wide.get_if<wide_error>();
+	nl::erased_error  wide_moved = std::move(wide);
+	assert(wide_moved.get_if<wide_error>() == address && wide.empty());
+
+	wide = first;
+	assert(wide == first);
+	first = std::move(wide_moved);
+	assert(first.get_if<wide_error>()->code == 42);
+
+	nl::erased_error exception(std::runtime_error("boom"));
+	assert(exception.message() == "boom");
+
+	return 0;
+}
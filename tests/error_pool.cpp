@@ -0,0 +1,85 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++17 -O1 -g -fsanitize=thread -I include tests/error_pool.cpp && ./a.out
+ */
+
+#include <expected/boxed.hpp>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+struct large_error {
+		int  code;
+		char detail[60];
+
+		friend bool operator==(const large_error& lhs, const large_error& rhs)
+		{
+			return lhs.code == rhs.code;
+		}
+};
+
+using result = nl::expected<int, nl::boxed<large_error>>;
+
+int main()
+{
+	// a freed block is handed straight back to the next allocation of its size class
+	const void* first_address = nullptr;
+	{
+		result failed = large_error{1, "first"};
+		first_address = &*failed.error();
+	}
+	{
+		nl::error_pool_stats before = nl::error_pool_statistics();
+		result		     failed = large_error{2, "second"};
+		nl::error_pool_stats after  = nl::error_pool_statistics();
+		assert(after.hits == before.hits + 1 && after.misses == before.misses);
+		assert(&*failed.error() == first_address);
+		assert(failed.error()->code == 2);
+		assert(failed.error() == nl::boxed<large_error>(large_error{2, "other"}));
+	}
+
+	// copies draw their own block and moves keep the original one
+	result		   original = large_error{3, "copied"};
+	result		   copy	    = original;
+	const large_error* address  = &*original.error();
+	assert(&*copy.error() != address && copy.error() == original.error());
+	result moved = std::move(original);
+	assert(&*moved.error() == address);
+
+	// blocks freed on another thread go back to the allocating thread's cache
+	std::vector<nl::boxed<large_error>> handed_off;
+	std::vector<const void*>	    addresses;
+	for (int i = 0; i < 64; i++)
+	{
+		handed_off.emplace_back(large_error{i, "remote"});
+		addresses.push_back(&*handed_off.back());
+	}
+	nl::error_pool_stats before = nl::error_pool_statistics();
+	std::thread consumer([&handed_off] { handed_off.clear(); });
+	consumer.join();
+	nl::error_pool_stats after = nl::error_pool_statistics();
+	assert(after.remote_frees == before.remote_frees + 64);
+
+	int reused = 0;
+	std::vector<nl::boxed<large_error>> again;
+	for (int i = 0; i < 64; i++)
+	{
+		again.emplace_back(large_error{i, "local"});
+		for (const void* previous : addresses)
+			reused += &*again.back() == previous;
+	}
+	assert(reused == 64);
+
+	// a thread's cache outlives the thread, so its blocks can still be freed afterwards
+	nl::boxed<large_error> survivor(large_error{0, ""});
+	std::thread producer([&survivor] { survivor = nl::boxed<large_error>(large_error{9, "from a finished thread"}); });
+	producer.join();
+	assert(survivor->code == 9);
+
+	return 0;
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include tests/error_scan.cpp && ./a.out
+ */
+
+#include <expected/scan.hpp>
+#include <cassert>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+	template<class T, class E, class Make>
+	void check(std::size_t count, double density, Make make)
+	{
+		std::mt19937		    engine(static_cast<unsigned>(count));
+		std::bernoulli_distribution failure(density);
+
+		std::vector<nl::expected<T, E>> results;
+		std::vector<std::size_t>	expected_indices;
+		for (std::size_t i = 0; i < count; i++)
+		{
+			if (failure(engine))
+			{
+				results.emplace_back(E());
+				expected_indices.push_back(i);
+			}
+			else
+			{
+				results.emplace_back(make(i));
+			}
+		}
+
+		assert(nl::count_errors(results.data(), count) == expected_indices.size());
+		assert(nl::any_error(results.data(), count) == not expected_indices.empty());
+		assert(nl::error_indices(results.data(), count) == expected_indices);
+		assert(nl::first_error_index(results.data(), count) == (expected_indices.empty() ? count : expected_indices.front()));
+	}
+}
+
+int main()
+{
+	const std::size_t sizes[]     = {0, 1, 15, 63, 64, 65, 200, 4099};
+	const double	  densities[] = {0.0, 0.01, 0.5, 1.0};
+
+	for (std::size_t size : sizes)
+	{
+		for (double density : densities)
+		{
+			check<int, std::errc>(size, density, [](std::size_t i) { return static_cast<int>(i); });
+			check<char, bool>(size, density, [](std::size_t i) { return static_cast<char>(i); });
+			check<short, char>(size, density, [](std::size_t i) { return static_cast<short>(i); });
+			check<std::string, int>(size, density, [](std::size_t i) { return std::to_string(i); });
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include tests/expected_generator.cpp && ./a.out
+ */
+
+#include <expected/coroutine.hpp>
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using result = nl::expected<int, std::string>;
+
+struct frame_counts {
+		int	    allocations   = 0;
+		int	    deallocations = 0;
+		std::size_t live_bytes	  = 0;
+};
+
+template<class T>
+struct counting_allocator {
+		using value_type = T;
+
+		frame_counts* counts;
+
+		explicit counting_allocator(frame_counts* c) noexcept : counts(c)
+		{
+		}
+
+		template<class U>
+		counting_allocator(const counting_allocator<U>& other) noexcept : counts(other.counts)
+		{
+		}
+
+		T* allocate(std::size_t n)
+		{
+			counts->allocations++;
+			counts->live_bytes += n * sizeof(T);
+			return std::allocator<T>().allocate(n);
+		}
+
+		void deallocate(T* pointer, std::size_t n) noexcept
+		{
+			counts->deallocations++;
+			counts->live_bytes -= n * sizeof(T);
+			std::allocator<T>().deallocate(pointer, n);
+		}
+};
+
+nl::expected_generator<int, std::string> numbers(int& produced)
+{
+	for (int i = 0; i < 5; i++)
+	{
+		produced++;
+		if (i == 2)
+			co_yield result(nl::unexpected(std::string("bad ") + std::to_string(i)));
+		else
+			co_yield result(i);
+	}
+}
+
+nl::expected_generator<int, std::string> counted(std::allocator_arg_t, counting_allocator<char>, int count)
+{
+	for (int i = 0; i < count; i++)
+		co_yield result(i);
+}
+
+nl::expected_generator<int, std::string> throwing()
+{
+	co_yield result(1);
+	throw std::logic_error("inside the generator");
+}
+
+nl::expected_generator<std::string, int> lvalues(std::string& after)
+{
+	nl::expected<std::string, int> local = std::string("kept");
+	co_yield local;
+	after = *local;
+}
+
+int main()
+{
+	// every element is produced when errors are not fatal
+	int		 produced = 0;
+	std::vector<int> values;
+	int		 errors = 0;
+	for (auto& item : numbers(produced))
+	{
+		if (item.has_value())
+			values.push_back(*item);
+		else
+			errors++;
+	}
+	assert(produced == 5 && errors == 1 && values.size() == 4);
+
+	// stop_on_error hands out the first error and never resumes the body again
+	produced = 0;
+	values.clear();
+	std::string first_error;
+	for (auto& item : numbers(produced).stop_on_error())
+	{
+		if (item.has_value())
+			values.push_back(*item);
+		else
+			first_error = item.error();
+	}
+	assert(values == (std::vector<int>{0, 1}));
+	assert(first_error == "bad 2");
+	assert(produced == 3);
+
+	// the frame comes from the allocator passed after allocator_arg and goes back to it
+	frame_counts counts;
+	{
+		auto generator = counted(std::allocator_arg, counting_allocator<char>(&counts), 3);
+		assert(counts.allocations == 1 && counts.live_bytes > 0);
+		int sum = 0;
+		for (auto& item : generator)
+			sum += *item;
+		assert(sum == 3);
+		assert(counts.deallocations == 0);
+	}
+	assert(counts.deallocations == 1 && counts.live_bytes == 0);
+
+	// an exception escaping the body reaches the consumer on the next resume
+	auto generator = throwing();
+	auto it	       = generator.begin();
+	assert(**it == 1);
+	bool caught = false;
+	try
+	{
+		++it;
+	}
+	catch (const std::logic_error&)
+	{
+		caught = true;
+	}
+	assert(caught);
+
+	// an lvalue is yielded by copy, so the consumer may move out of it freely
+	std::string after;
+	for (auto& item : lvalues(after))
+	{
+		std::string taken = *std::move(item);
+		assert(taken == "kept");
+	}
+	assert(after == "kept");
+
+	return 0;
+}
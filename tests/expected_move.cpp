@@ -0,0 +1,150 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include tests/expected_move.cpp && ./a.out
+ */
+
+#include <expected.hpp>
+#include <cassert>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+struct counted {
+		static int copies;
+
+		int id;
+
+		counted(int i) : id(i)
+		{
+		}
+
+		counted(const counted& other) : id(other.id)
+		{
+			copies++;
+		}
+
+		counted(counted&& other) noexcept : id(other.id)
+		{
+			other.id = -1;
+		}
+
+		counted& operator=(const counted& other)
+		{
+			id = other.id;
+			copies++;
+			return *this;
+		}
+
+		counted& operator=(counted&& other) noexcept
+		{
+			id	 = other.id;
+			other.id = -1;
+			return *this;
+		}
+};
+
+int counted::copies = 0;
+
+// moves throw on demand, so assignment has to survive a payload that cannot be moved
+struct fragile {
+		static bool fail;
+
+		int id;
+
+		fragile(int i) : id(i)
+		{
+		}
+
+		fragile(const fragile& other) : id(other.id)
+		{
+			if (fail)
+				throw std::runtime_error("copy");
+		}
+
+		fragile(fragile&& other) : id(other.id)
+		{
+			if (fail)
+				throw std::runtime_error("move");
+		}
+
+		fragile& operator=(const fragile&) = default;
+		fragile& operator=(fragile&&)	   = default;
+};
+
+bool fragile::fail = false;
+
+struct brittle {
+		std::string text;
+
+		brittle(const char* t) : text(t)
+		{
+		}
+
+		brittle(const brittle&)		  = default;
+		brittle(brittle&& other) noexcept(false) : text(std::move(other.text))
+		{
+		}
+
+		brittle& operator=(const brittle&) = default;
+		brittle& operator=(brittle&&)	   = default;
+};
+
+int main()
+{
+	// moving an expected moves its payload instead of copying it
+	nl::expected<counted, int> value = counted(1);
+	counted::copies			 = 0;
+	nl::expected<counted, int> moved = std::move(value);
+	assert(moved.value().id == 1 && value.value().id == -1);
+
+	nl::expected<int, counted> error = counted(2);
+	nl::expected<int, counted> target = 3;
+	target				  = std::move(error);
+	assert(not target.has_value() && target.error().id == 2 && error.error().id == -1);
+	error = std::move(target);
+	assert(error.error().id == 2 && target.error().id == -1);
+	assert(counted::copies == 0);
+
+	// move-only payloads can be moved in and out
+	nl::expected<std::unique_ptr<int>, std::string> owner = std::unique_ptr<int>(new int(4));
+	nl::expected<std::unique_ptr<int>, std::string> taken = std::move(owner);
+	assert(*taken.value() == 4 && owner.value() == nullptr);
+	owner = std::move(taken);
+	assert(*owner.value() == 4 && taken.value() == nullptr);
+
+	// move operations are noexcept only when both payloads move without throwing
+	static_assert(std::is_nothrow_move_constructible<nl::expected<int, std::string>>::value, "");
+	static_assert(std::is_nothrow_move_assignable<nl::expected<int, std::string>>::value, "");
+	static_assert(not std::is_nothrow_move_constructible<nl::expected<fragile, int>>::value, "");
+	static_assert(not std::is_nothrow_move_assignable<nl::expected<fragile, int>>::value, "");
+
+	// a throwing move leaves the assigned-to expected as it was instead of terminating
+	nl::expected<fragile, int> holder = 7;
+	nl::expected<fragile, int> source = fragile(8);
+	fragile::fail			  = true;
+	bool thrown			  = false;
+	try
+	{
+		holder = std::move(source);
+	}
+	catch (const std::runtime_error&)
+	{
+		thrown = true;
+	}
+	fragile::fail = false;
+	assert(thrown && not holder.has_value() && holder.error() == 7);
+
+	// assignment between two payloads that both throw on move still compiles and works
+	nl::expected<fragile, brittle> both = fragile(1);
+	both				    = nl::expected<fragile, brittle>(brittle("error"));
+	assert(not both.has_value() && both.error().text == "error");
+	both = nl::expected<fragile, brittle>(fragile(2));
+	assert(both.has_value() && both.value().id == 2);
+
+	return 0;
+}
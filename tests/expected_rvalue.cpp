@@ -0,0 +1,60 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include tests/expected_rvalue.cpp && ./a.out
+ */
+
+#include <expected.hpp>
+#include <cassert>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct tracked {
+		static int copies;
+
+		std::vector<int> data;
+
+		explicit tracked(std::vector<int> d) : data(std::move(d))
+		{
+		}
+
+		tracked(const tracked& other) : data(other.data)
+		{
+			copies++;
+		}
+
+		tracked(tracked&&) noexcept = default;
+};
+
+int tracked::copies = 0;
+
+int main()
+{
+	// rvalue payloads are moved into the expected, lvalues are still copied
+	tracked value(std::vector<int>(1000, 1));
+	const int* buffer = value.data.data();
+	nl::expected<tracked, int> moved(std::move(value));
+	assert(tracked::copies == 0 && moved.value().data.data() == buffer);
+	nl::expected<tracked, int> copied(moved.value());
+	assert(tracked::copies == 1 && copied.value().data.size() == 1000);
+
+	nl::expected<int, tracked> error(tracked(std::vector<int>(3, 2)));
+	assert(not error.has_value() && error.error().data.size() == 3 && tracked::copies == 1);
+
+	// move-only payloads are constructible on either side
+	nl::expected<std::unique_ptr<int>, int>	 owner = std::make_unique<int>(6);
+	nl::expected<int, std::unique_ptr<int>> failed = std::make_unique<int>(9);
+	assert(*owner.value() == 6 && *failed.error() == 9);
+
+	// overload resolution picks the same side as the const& constructors alone
+	nl::expected<int, double>	 exact = 1;
+	nl::expected<double, int>	 other = 1;
+	nl::expected<std::string, int> text("literal");
+	assert(exact.has_value() && not other.has_value() && text.value() == "literal");
+
+	return 0;
+}
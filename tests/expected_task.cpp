@@ -0,0 +1,134 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include tests/expected_task.cpp && ./a.out
+ */
+
+#include <expected/coroutine.hpp>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+struct tracked {
+		static int copies;
+		int	   value;
+
+		explicit tracked(int v) : value(v)
+		{
+		}
+
+		tracked(const tracked& other) : value(other.value)
+		{
+			copies++;
+		}
+
+		tracked(tracked&& other) noexcept : value(other.value)
+		{
+			other.value = -1;
+		}
+
+		tracked& operator=(const tracked&) = default;
+		tracked& operator=(tracked&&)	   = default;
+};
+
+int tracked::copies = 0;
+
+using result = nl::expected<int, std::string>;
+
+nl::expected<int, std::string> parse(int input)
+{
+	if (input < 0)
+		return nl::unexpected(std::string("negative"));
+	return input;
+}
+
+nl::expected_task<int, std::string> level(int depth, int input)
+{
+	if (depth == 0)
+		co_return parse(input);
+	int value = co_await level(depth - 1, input);
+	co_return value + 1;
+}
+
+nl::expected_task<int, std::string> stops_early(int& reached)
+{
+	int first = co_await parse(-1);
+	reached	  = 1;
+	co_return first;
+}
+
+nl::expected_task<int, std::string> throws()
+{
+	int value = co_await parse(1);
+	if (value == 1)
+		throw std::logic_error("inside the task");
+	co_return value;
+}
+
+nl::expected_task<int, std::string> borrow(nl::expected<tracked, std::string>& source)
+{
+	tracked& seen = co_await source;
+	co_return seen.value;
+}
+
+nl::expected_task<int, std::string> take(nl::expected<tracked, std::string> source)
+{
+	tracked owned = co_await std::move(source);
+	co_return owned.value;
+}
+
+int main()
+{
+	// values and errors round-trip through five nested awaits
+	result ok = level(5, 10);
+	assert(ok.has_value() && *ok == 15);
+	result failed = level(5, -1);
+	assert(not failed.has_value() && failed.error() == "negative");
+	assert(result(level(2, 1)).value() == 3);
+
+	// an error stops the coroutine at the await that produced it
+	int reached = 0;
+	assert(result(stops_early(reached)).error() == "negative");
+	assert(reached == 0);
+
+	// exceptions are kept in the promise and rethrown by get
+	auto task = throws();
+	bool caught = false;
+	try
+	{
+		std::move(task).get();
+	}
+	catch (const std::logic_error&)
+	{
+		caught = true;
+	}
+	assert(caught);
+
+	// a moved-from task is empty and refuses to produce a result
+	auto first  = level(0, 4);
+	auto second = std::move(first);
+	assert(std::move(second).get().value() == 4);
+	caught = false;
+	try
+	{
+		std::move(first).get();
+	}
+	catch (const std::runtime_error&)
+	{
+		caught = true;
+	}
+	assert(caught);
+
+	// awaiting an lvalue borrows it, awaiting an rvalue moves out of it
+	nl::expected<tracked, std::string> source = tracked(7);
+	tracked::copies				  = 0;
+	assert(result(borrow(source)).value() == 7);
+	assert(source->value == 7 && tracked::copies == 0);
+	assert(result(take(std::move(source))).value() == 7);
+	assert(tracked::copies == 0);
+
+	return 0;
+}
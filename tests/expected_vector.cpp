@@ -0,0 +1,112 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include tests/expected_vector.cpp && ./a.out
+ */
+
+#include <expected/expected_vector.hpp>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+struct fragile {
+		int value = 0;
+
+		fragile() = default;
+
+		explicit fragile(int v) : value(v)
+		{
+			if (v < 0)
+				throw std::invalid_argument("negative");
+		}
+};
+
+int main()
+{
+	nl::expected_vector<fragile, std::string> results;
+	results.emplace_back(1);
+
+	bool thrown = false;
+	try
+	{
+		results.emplace_back(-1);
+	}
+	catch (const std::invalid_argument&)
+	{
+		thrown = true;
+	}
+	assert(thrown);
+	assert(results.size() == 1);
+
+	results.push_error(std::string("failed"));
+	assert(results.size() == 2);
+	assert(not results.has_value(1));
+	assert(results[1].error() == "failed");
+
+	for (int i = 2; i < 200; i++)
+	{
+		if (i % 5 == 0)
+			results.push_error(std::to_string(i));
+		else
+			results.emplace_back(i);
+	}
+
+	assert(results.size() == 200);
+	for (std::size_t i = 2; i < 200; i++)
+	{
+		assert(results.has_value(i) == (i % 5 != 0));
+		if (results.has_value(i))
+			assert(results[i].value().value == static_cast<int>(i));
+		else
+			assert(results[i].error() == std::to_string(i));
+	}
+
+	// values() skips every error, including runs that cover whole bitmap words
+	nl::expected_vector<int, std::string> sparse;
+	for (int i = 0; i < 1000; i++)
+	{
+		if ((i >= 100 && i < 300) || i % 7 == 0)
+			sparse.push_error(std::to_string(i));
+		else
+			sparse.push_back(i);
+	}
+	std::vector<int>	 expected_values;
+	std::vector<std::size_t> expected_indices;
+	for (std::size_t i = 0; i < sparse.size(); i++)
+	{
+		if (sparse.has_value(i))
+		{
+			expected_values.push_back(sparse[i].value());
+			expected_indices.push_back(i);
+		}
+	}
+	std::vector<int>	 walked_values;
+	std::vector<std::size_t> walked_indices;
+	for (auto it = sparse.values().begin(); it != sparse.values().end(); ++it)
+	{
+		walked_values.push_back(*it);
+		walked_indices.push_back(it.index());
+	}
+	assert(walked_values == expected_values && walked_indices == expected_indices);
+
+	nl::expected_vector<int, std::string> all_errors;
+	for (int i = 0; i < 130; i++)
+		all_errors.push_error("e");
+	assert(all_errors.values().begin() == all_errors.values().end());
+
+	// bools are stored a byte each so value() can hand out a reference
+	nl::expected_vector<bool, std::string> flags;
+	flags.push_back(true);
+	flags.push_error(std::string("unknown"));
+	bool& stored = flags.emplace_back(false);
+	stored	     = true;
+	flags[0].value() = false;
+	assert(not flags[0].value() && flags[2].value() && flags[1].error() == "unknown");
+	std::vector<bool> walked_flags(flags.values().begin(), flags.values().end());
+	assert(walked_flags == std::vector<bool>({false, true}));
+
+	return 0;
+}
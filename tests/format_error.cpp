@@ -0,0 +1,74 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++17 -O2 -I include tests/format_error.cpp && ./a.out
+ */
+
+#include <expected/format_error.hpp>
+#include <cassert>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+enum class stage {
+	lex   = 1,
+	parse = 2,
+};
+
+nl::expected<int, nl::format_error<int, const char*>> parse(int line, const std::string& file)
+{
+	// the c_str() pointer dies with the caller's string, the error must not
+	return nl::unexpected(nl::make_format_error("failed to parse line {} of {}", line, std::string(file).c_str()));
+}
+
+int main()
+{
+	// the error round-trips through expected and renders its arguments on demand
+	auto failed = parse(12, "configuration.toml");
+	assert(not failed.has_value());
+	assert(failed.error().message() == "failed to parse line 12 of configuration.toml");
+	assert(std::string(failed.error().format()) == "failed to parse line {} of {}");
+
+	// copies are byte copies that render the same message
+	static_assert(std::is_trivially_copyable<nl::format_error<int, const char*>>::value, "");
+	auto copy = failed.error();
+	failed	  = 1;
+	assert(copy.message() == "failed to parse line 12 of configuration.toml");
+
+	// every kind of string argument is copied when the error is made
+	std::string owned = "owned";
+	std::string viewed = "viewed";
+	auto	    strings = nl::make_format_error("{} {} {}", owned, std::string_view(viewed), "literal");
+	owned.assign("changed");
+	viewed.assign("VIEWED");
+	assert(strings.message() == "owned viewed literal");
+
+	// class template argument deduction decays arrays the same way make_format_error does
+	nl::format_error deduced("line {} of {}", 3, "abc");
+	static_assert(std::is_same<decltype(deduced), nl::format_error<int, const char*>>::value, "");
+	assert(deduced.message() == "line 3 of abc");
+
+	// long strings are cut to the inline capacity, null pointers are spelled out
+	std::string long_name(200, 'x');
+	auto	    cut = nl::make_format_error("{}", long_name.c_str());
+	long_name.clear();
+	assert(cut.message() == std::string(44, 'x') + "...");
+	const char* null = nullptr;
+	assert(nl::make_format_error("{}", null).message() == "(null)");
+
+	// the other argument kinds and the escapes
+	auto mixed = nl::make_format_error("{{{}}} {} {} {}", 'c', true, stage::parse, 2.5);
+	assert(mixed.message() == "{c} true 2 2.5");
+
+#if defined(__cpp_consteval)
+	// the placeholder count is checked against the arguments when the error is made
+	static_assert(nl::detail::count_placeholders("{{{}}} {} {} {}") == 4, "");
+	static_assert(nl::detail::count_placeholders("{{}} }} {{") == 0, "");
+#else
+	assert(nl::make_format_error("missing {} {}", 1).message() == "missing 1 {}");
+#endif
+
+	return 0;
+}
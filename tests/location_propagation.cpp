@@ -0,0 +1,95 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include tests/location_propagation.cpp && ./a.out
+ */
+
+#if not defined(NL_EXPECTED_SOURCE_LOCATION)
+#define NL_EXPECTED_SOURCE_LOCATION
+#endif
+
+#include <expected.hpp>
+#include <expected/algorithm.hpp>
+#include <expected/coroutine.hpp>
+#include <expected/sequence.hpp>
+#include <expected/thread_pool.hpp>
+#include <expected/views.hpp>
+#include <cassert>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using result = nl::expected<int, std::string>;
+
+namespace {
+	unsigned error_line = 0;
+
+	result parse(int input)
+	{
+		error_line = __LINE__ + 2;
+		if (input < 0)
+			return nl::unexpected(std::string("negative"));
+		return input;
+	}
+
+	template<class Result>
+	bool from_parse(const Result& failed)
+	{
+		return not failed.has_value() && failed.error_location().line() == error_line;
+	}
+
+#if defined(__cpp_impl_coroutine)
+	nl::expected_task<int, std::string> awaiting(int input)
+	{
+		int value = co_await parse(input);
+		co_return value + 1;
+	}
+
+	nl::expected_task<int, std::string> nested(int input)
+	{
+		int value = co_await awaiting(input);
+		co_return value + 1;
+	}
+#endif
+}
+
+int main()
+{
+#if defined(NL_EXPECTED_SOURCE_LOCATION) && defined(__cpp_lib_source_location)
+	// an error re-wrapped by an adapter keeps the location it was created at
+	std::vector<result> results{parse(1), parse(-1), parse(2)};
+	assert(from_parse(results[1]));
+
+	assert(from_parse(nl::collect<std::vector<int>>(results)));
+	assert(from_parse(nl::collect<std::vector<int>>(std::move(results))));
+
+	assert(from_parse(nl::sequence(parse(1), parse(-1))));
+	assert(from_parse(nl::apply_ok([](int a, int b) { return a + b; }, parse(1), parse(-1))));
+
+#if defined(__cpp_impl_coroutine)
+	assert(from_parse(awaiting(-1).get()));
+	assert(from_parse(nested(-1).get()));
+#endif
+
+#if defined(__cpp_lib_ranges)
+	std::vector<result> ranged{parse(-1)};
+	for (const auto& mapped : ranged | nl::views::transform_ok([](int value) { return value * 2; }))
+		assert(from_parse(mapped));
+	for (const auto& chained : ranged | nl::views::and_then([](int value) { return result(value); }))
+		assert(from_parse(chained));
+#endif
+
+	nl::thread_pool pool(2);
+	std::vector<nl::expected_future<int, std::string>> futures;
+	futures.push_back(pool.submit([] { return parse(1); }));
+	futures.push_back(pool.submit([] { return parse(-1); }));
+	assert(from_parse(nl::when_all(std::move(futures))));
+
+	std::vector<int> inputs{1, 2, -3, 4};
+	assert(from_parse(nl::parallel_transform(inputs, parse, pool)));
+#endif
+
+	return 0;
+}
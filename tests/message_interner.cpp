@@ -0,0 +1,135 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++17 -O1 -g -fsanitize=thread -I include tests/message_interner.cpp && ./a.out
+ */
+
+#include <expected/interner.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main()
+{
+	// the same text maps to the same id, and the id maps back to the text
+	nl::message_interner interner(16);
+	std::uint32_t	     first = interner.intern("file not found");
+	assert(first == 1);
+	assert(interner.intern(std::string("file not found")) == first);
+	assert(interner.find("file not found", 14) == first);
+	assert(interner.find("permission denied", 17) == 0);
+	std::uint32_t second = interner.intern("permission denied");
+	assert(second == 2 && interner.size() == 2);
+	assert(interner.text(second) == "permission denied");
+
+	bool caught = false;
+	try
+	{
+		interner.text(3);
+	}
+	catch (const std::runtime_error&)
+	{
+		caught = true;
+	}
+	assert(caught);
+
+	// interned errors compare by id and are plain copies of it
+	nl::interned_error missing("no such key");
+	nl::interned_error again(std::string("no such key"));
+	nl::interned_error other("timed out");
+	assert(missing == again && missing != other);
+	assert(missing.message() == "no such key");
+	nl::interned_error copy = missing;
+	assert(copy == missing && copy.id() == missing.id());
+
+	nl::expected<int, nl::interned_error> failed = nl::unexpected(nl::interned_error("timed out"));
+	assert(not failed.has_value() && failed.error() == other);
+
+	// filling the interner to capacity is an error, repeats of known text are not
+	nl::message_interner small(2);
+	small.intern("a");
+	small.intern("b");
+	assert(small.intern("a") == 1);
+	caught = false;
+	try
+	{
+		small.intern("c");
+	}
+	catch (const std::runtime_error&)
+	{
+		caught = true;
+	}
+	assert(caught && small.size() == 2);
+
+	// many threads racing on the same texts take exactly one id per distinct text, so an
+	// interner sized for the texts never runs out and the ids come out dense
+	constexpr int			 texts	 = 2000;
+	constexpr int			 threads = 8;
+	nl::message_interner		 shared(texts);
+	std::vector<std::vector<std::uint32_t>> ids(threads, std::vector<std::uint32_t>(texts));
+	std::atomic<bool>		 start(false);
+	std::vector<std::thread>	 workers;
+	for (int t = 0; t < threads; t++)
+	{
+		workers.emplace_back(
+		    [&, t]
+		    {
+			    while (not start.load(std::memory_order_acquire))
+				    std::this_thread::yield();
+			    for (int i = 0; i < texts; i++)
+			    {
+				    int index	 = (i * (t + 1)) % texts;
+				    ids[t][index] = shared.intern("message " + std::to_string(index));
+			    }
+		    });
+	}
+	// a reader racing the writers sees either nothing or the final id, and never waits on a
+	// slot that is still being filled
+	std::atomic<bool> stop(false);
+	std::thread	  reader(
+	      [&]
+	      {
+		      while (not start.load(std::memory_order_acquire))
+			      std::this_thread::yield();
+		      while (not stop.load(std::memory_order_acquire))
+		      {
+			      for (int i = 0; i < texts; i += 97)
+			      {
+				      std::string   text = "message " + std::to_string(i);
+				      std::uint32_t id	 = shared.find(text.data(), text.size());
+				      assert(id == 0 || shared.text(id) == text);
+			      }
+		      }
+	      });
+	start.store(true, std::memory_order_release);
+	for (auto& worker : workers)
+		worker.join();
+	stop.store(true, std::memory_order_release);
+	reader.join();
+
+	// (i * (t + 1)) % texts only covers every index when t + 1 is coprime with texts, so the
+	// comparison is made against the first thread, which visits them all
+	assert(shared.size() == texts);
+	std::vector<std::uint32_t> sorted = ids[0];
+	std::sort(sorted.begin(), sorted.end());
+	for (int i = 0; i < texts; i++)
+		assert(sorted[i] == static_cast<std::uint32_t>(i + 1));
+	for (int t = 0; t < threads; t++)
+	{
+		for (int i = 0; i < texts; i++)
+		{
+			if (ids[t][i] != 0)
+				assert(ids[t][i] == ids[0][i]);
+		}
+	}
+	for (int i = 0; i < texts; i++)
+		assert(shared.text(ids[0][i]) == "message " + std::to_string(i));
+
+	return 0;
+}
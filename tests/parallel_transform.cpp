@@ -0,0 +1,82 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O1 -g -fsanitize=thread -I include tests/parallel_transform.cpp && ./a.out
+ */
+
+#include <expected/thread_pool.hpp>
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main()
+{
+	std::vector<int> inputs(100000);
+	std::iota(inputs.begin(), inputs.end(), 0);
+
+	auto parity = nl::parallel_transform(inputs, [](int i) { return nl::expected<bool, std::string>(i % 2 == 0); }, 8);
+	assert(parity.has_value() && parity->size() == inputs.size());
+	for (std::size_t i = 0; i < inputs.size(); i++)
+		assert((*parity)[i] == (i % 2 == 0));
+
+	nl::thread_pool pool(4);
+	auto pooled = nl::parallel_transform(inputs, [](int i) { return nl::expected<bool, std::string>(i % 3 == 0); }, pool);
+	assert(pooled.has_value());
+	for (std::size_t i = 0; i < inputs.size(); i++)
+		assert((*pooled)[i] == (i % 3 == 0));
+
+	auto doubled = nl::parallel_transform(inputs, [](int i) { return nl::expected<long, std::string>(2L * i); }, 8);
+	assert(doubled.has_value() && (*doubled)[99999] == 199998);
+
+	auto failed = nl::parallel_transform(
+	    inputs,
+	    [](int i)
+	    {
+		    if (i == 5000)
+			    return nl::expected<bool, std::string>(std::string("bad input"));
+		    return nl::expected<bool, std::string>(true);
+	    },
+	    8);
+	assert(not failed.has_value() && failed.error() == "bad input");
+
+	// a thrown exception and a returned error are ordered by the element that produced them;
+	// the earlier element is slowed down so that the later failure is published first
+	auto fails_at = [](int error_at, int throw_at)
+	{
+		return [=](int i)
+		{
+			if (i == std::min(error_at, throw_at))
+				std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			if (i == throw_at)
+				throw std::runtime_error("thrown");
+			if (i == error_at)
+				return nl::expected<bool, std::string>(std::string("returned"));
+			return nl::expected<bool, std::string>(true);
+		};
+	};
+	for (int round = 0; round < 5; round++)
+	{
+		auto returned = nl::parallel_transform(inputs, fails_at(5, 90000), pool);
+		assert(not returned.has_value() && returned.error() == "returned");
+
+		bool thrown = false;
+		try
+		{
+			nl::parallel_transform(inputs, fails_at(90000, 5), pool);
+		}
+		catch (const std::runtime_error&)
+		{
+			thrown = true;
+		}
+		assert(thrown);
+	}
+
+	return 0;
+}
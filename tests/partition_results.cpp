@@ -0,0 +1,100 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include tests/partition_results.cpp && ./a.out
+ */
+
+#include <expected/algorithm.hpp>
+#include <cassert>
+#include <iterator>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using result = nl::expected<std::string, int>;
+
+namespace {
+	std::vector<result> make_results()
+	{
+		std::vector<result> results;
+		results.emplace_back(std::string("zero"));
+		results.emplace_back(1);
+		results.emplace_back(std::string("two"));
+		results.emplace_back(3);
+		return results;
+	}
+
+	// neither a std view nor a borrowed range, but it still refers to the caller's elements
+	struct wrapper {
+			std::vector<result>::iterator first;
+			std::vector<result>::iterator last;
+
+			std::vector<result>::iterator begin() const
+			{
+				return first;
+			}
+
+			std::vector<result>::iterator end() const
+			{
+				return last;
+			}
+	};
+
+	wrapper make_wrapper(std::vector<result>& results)
+	{
+		return wrapper{results.begin(), results.end()};
+	}
+}
+
+int main()
+{
+	std::vector<result> results = make_results();
+
+	auto copied = nl::partition_results(results);
+	assert(copied.first.size() == 2 && copied.first[0] == "zero");
+	assert(copied.second.size() == 2 && copied.second[1].first == 3);
+	assert(*results[0] == "zero");
+
+	auto viewed = nl::partition_results(std::views::all(results));
+	assert(viewed.first[1] == "two");
+	assert(*results[0] == "zero" && *results[2] == "two");
+
+	auto taken = nl::partition_results(results | std::views::take_while([](const result&) { return true; }));
+	assert(taken.first.size() == 2 && taken.second.size() == 2);
+	assert(*results[2] == "two");
+
+	auto generated = nl::partition_results(std::views::iota(0, 6) | std::views::transform([](int i) {
+		return i % 2 == 0 ? result(std::to_string(i)) : result(i);
+	}));
+	assert(generated.first.size() == 3 && generated.first[2] == "4");
+	assert(generated.second.size() == 3 && generated.second[0].first == 1);
+
+	// an istream view reads an element on every begin(), so taking begin() twice would drop one
+	std::istringstream numbers("0 1 2 3 4 5");
+	auto		   streamed = nl::partition_results(std::views::istream<int>(numbers) | std::views::transform([](int i) {
+		   return i % 2 == 0 ? result(std::to_string(i)) : result(i);
+	}));
+	assert(streamed.first.size() == 3 && streamed.first[0] == "0");
+	assert(streamed.second.size() == 3 && streamed.second[2].first == 5);
+
+	auto wrapped = nl::partition_results(make_wrapper(results));
+	assert(wrapped.first.size() == 2 && wrapped.first[1] == "two");
+	assert(*results[0] == "zero" && *results[2] == "two");
+
+	auto moved = nl::partition_results(std::move(results));
+	assert(moved.first[0] == "zero");
+	assert(results[0]->empty());
+
+	std::vector<result> source = make_results();
+	std::vector<std::string> values;
+	std::vector<std::pair<std::size_t, int>> errors;
+	auto bounded = std::views::counted(source.begin(), 3);
+	nl::partition_results(bounded.begin(), std::ranges::end(bounded), std::back_inserter(values), std::back_inserter(errors));
+	assert(values.size() == 2 && errors.size() == 1);
+	assert(*source[0] == "zero");
+
+	return 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include tests/pmr_assignment.cpp && ./a.out
+ */
+
+#include <expected/pmr.hpp>
+#include <cassert>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+	std::size_t global_allocations = 0;
+}
+
+void* operator new(std::size_t size)
+{
+	global_allocations++;
+	if (void* pointer = std::malloc(size == 0 ? 1 : size))
+		return pointer;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+	std::free(pointer);
+}
+
+int main()
+{
+	static char buffer[1 << 16];
+	std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+	const std::string message = "a message long enough to skip the small string buffer";
+
+	std::size_t before = global_allocations;
+	{
+		std::pmr::vector<nl::pmr::expected<int>> results(&arena);
+		results.reserve(8);
+		results.emplace_back(std::pmr::string(message.c_str(), &arena));
+		results.emplace_back(std::pmr::string("another message that also lives on the heap", &arena));
+		results.emplace_back(3);
+		results.emplace_back(4);
+
+		results[1] = results[0];
+		assert(results[1].error() == message.c_str());
+		assert(results[1].error().get_allocator().resource() == &arena);
+
+		results[2] = results[0];
+		assert(results[2].error().get_allocator().resource() == &arena);
+
+		results[0] = results[3];
+		assert(results[0].has_value() && *results[0] == 4);
+
+		results[0] = std::move(results[1]);
+		assert(results[0].error().get_allocator().resource() == &arena);
+
+		results[3] = nl::pmr::expected<int>(std::pmr::string(message.c_str(), &arena));
+		assert(results[3].error().get_allocator().resource() == &arena);
+
+		results[1] = 9;
+		assert(results[1].has_value() && *results[1] == 9);
+	}
+	assert(global_allocations == before);
+
+	return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++17 -O2 -I include tests/sequence.cpp && ./a.out
+ */
+
+#include <expected/sequence.hpp>
+#include <cassert>
+#include <string>
+#include <tuple>
+#include <utility>
+
+struct tracked {
+		static int copies;
+		static int moves;
+		int	   value;
+
+		explicit tracked(int v) : value(v)
+		{
+		}
+
+		tracked(const tracked& other) : value(other.value)
+		{
+			copies++;
+		}
+
+		tracked(tracked&& other) noexcept : value(other.value)
+		{
+			moves++;
+			other.value = -1;
+		}
+
+		tracked& operator=(const tracked&) = default;
+		tracked& operator=(tracked&&)	   = default;
+};
+
+int tracked::copies = 0;
+int tracked::moves  = 0;
+
+using number = nl::expected<int, std::string>;
+using real   = nl::expected<double, std::string>;
+using object = nl::expected<tracked, std::string>;
+
+int main()
+{
+	// every input present: the values are gathered in argument order
+	number first  = 1;
+	number second = 2;
+	auto   all    = nl::sequence(first, second, number(3));
+	assert(all.has_value());
+	assert(*all == std::make_tuple(1, 2, 3));
+
+	// the error of the leftmost failing argument wins, whatever follows it
+	number bad   = nl::unexpected(std::string("second"));
+	number worse = nl::unexpected(std::string("third"));
+	auto   some  = nl::sequence(first, bad, worse);
+	assert(not some.has_value() && some.error() == "second");
+	auto only_last = nl::sequence(first, second, worse);
+	assert(not only_last.has_value() && only_last.error() == "third");
+
+	auto sum = nl::apply_ok([](int a, int b, int c) { return a + b + c; }, first, second, number(4));
+	assert(sum.has_value() && *sum == 7);
+	auto failed_sum = nl::apply_ok([](int a, int b) { return a + b; }, worse, bad);
+	assert(failed_sum.error() == "third");
+
+	// a callable returning expected is not wrapped a second time
+	auto checked = nl::apply_ok([](int a, int b) { return b == 0 ? number(nl::unexpected(std::string("zero"))) : number(a / b); },
+	    number(6), number(0));
+	static_assert(std::is_same<decltype(checked), number>::value, "");
+	assert(checked.error() == "zero");
+
+	// rvalues are moved into the tuple, lvalues are copied only once
+	object owned	 = tracked(5);
+	object borrowed	 = tracked(6);
+	tracked::copies	 = 0;
+	tracked::moves	 = 0;
+	auto mixed	 = nl::sequence(std::move(owned), borrowed, real(1.5));
+	assert(mixed.has_value());
+	assert(std::get<0>(*mixed).value == 5 && std::get<1>(*mixed).value == 6 && std::get<2>(*mixed) == 1.5);
+	assert(tracked::copies == 1);
+	assert(borrowed->value == 6);
+
+	// apply_ok hands lvalues to the callable by reference and rvalues by rvalue reference
+	object moved_in	= tracked(8);
+	tracked::copies = 0;
+	auto seen	= nl::apply_ok(
+	      [](const tracked& kept, tracked&& taken)
+	      {
+		      tracked local(std::move(taken));
+		      return kept.value + local.value;
+	      },
+	      borrowed, std::move(moved_in));
+	assert(seen.has_value() && *seen == 14);
+	assert(tracked::copies == 0);
+	assert(borrowed->value == 6);
+
+	return 0;
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++17 -O1 -g -fsanitize=thread -I include tests/shared_error.cpp && ./a.out
+ */
+
+#include <expected/shared_error.hpp>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+struct diagnostic {
+		static int live;
+		std::string message;
+
+		explicit diagnostic(std::string text) : message(std::move(text))
+		{
+			live++;
+		}
+
+		diagnostic(const diagnostic& other) : message(other.message)
+		{
+			live++;
+		}
+
+		~diagnostic()
+		{
+			live--;
+		}
+
+		friend bool operator==(const diagnostic& lhs, const diagnostic& rhs)
+		{
+			return lhs.message == rhs.message;
+		}
+};
+
+int diagnostic::live = 0;
+
+int main()
+{
+	{
+		// the error round-trips through expected and copies share the one payload
+		using shared = nl::shared_error<diagnostic>;
+		nl::expected<int, shared> failed = nl::unexpected(shared(diagnostic("disk full")));
+		assert(not failed.has_value() && failed.error()->message == "disk full");
+		assert(diagnostic::live == 1 && failed.error().use_count() == 1);
+
+		nl::expected<int, shared> copy = failed;
+		assert(copy.error().use_count() == 2 && &*copy.error() == &*failed.error());
+		assert(diagnostic::live == 1);
+
+		// equal payloads in different nodes compare equal, different payloads do not
+		shared same(diagnostic("disk full"));
+		shared other(diagnostic("disk empty"));
+		assert(same == failed.error() && other != failed.error());
+
+		// moving hands the node over without touching the count
+		shared moved = std::move(same);
+		assert(moved.use_count() == 1 && same.use_count() == 0);
+
+		// an empty handle equals only another empty handle
+		shared also_moved = std::move(other);
+		assert(same == other && not(same != other));
+		assert(same != moved && moved != same && not(same == moved));
+
+		// the count drops as handles go away, and the payload dies with the last one
+		{
+			std::vector<shared> handles(8, moved);
+			assert(moved.use_count() == 9);
+		}
+		assert(moved.use_count() == 1);
+		copy = 1;
+		assert(failed.error().use_count() == 1);
+		int before = diagnostic::live;
+		moved	   = also_moved;
+		assert(diagnostic::live == before - 1 && moved.use_count() == 2);
+	}
+	assert(diagnostic::live == 0);
+
+	{
+		// the atomic count survives copies and releases racing across threads
+		nl::shared_error<diagnostic> source(diagnostic("shared across threads"));
+		std::vector<std::thread>     threads;
+		for (int t = 0; t < 4; t++)
+		{
+			threads.emplace_back(
+			    [source]
+			    {
+				    for (int i = 0; i < 1000; i++)
+				    {
+					    nl::shared_error<diagnostic> copy = source;
+					    assert(copy->message == "shared across threads");
+				    }
+			    });
+		}
+		for (auto& thread : threads)
+			thread.join();
+		assert(source.use_count() == 1);
+	}
+	assert(diagnostic::live == 0);
+
+	{
+		nl::shared_error<diagnostic, nl::local_refcount> local(diagnostic("single thread"));
+		auto						  copy = local;
+		assert(local.use_count() == 2 && copy == local);
+	}
+	assert(diagnostic::live == 0);
+
+	return 0;
+}
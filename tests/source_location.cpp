@@ -0,0 +1,93 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * build and run it in both modes:
+ * g++ -std=c++20 -O2 -I include tests/source_location.cpp && ./a.out
+ * g++ -std=c++20 -O2 -DNL_EXPECTED_SOURCE_LOCATION -I include tests/source_location.cpp && ./a.out
+ */
+
+#include <expected.hpp>
+#include <expected/status_code.hpp>
+#include <cassert>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <typeinfo>
+
+#if defined(NL_EXPECTED_SOURCE_LOCATION) && defined(__cpp_lib_source_location)
+#define captures_location
+#endif
+
+namespace {
+	unsigned error_line = 0;
+
+	template<class T, class E>
+	struct plain_layout {
+			bool has_value;
+
+			union {
+					T value;
+					E error;
+			};
+	};
+
+#if defined(captures_location)
+	template<class T, class E>
+	struct located_layout : plain_layout<T, E> {
+			std::source_location location;
+	};
+
+	template<class T, class E>
+	using reference_layout = located_layout<T, E>;
+#else
+	template<class T, class E>
+	using reference_layout = plain_layout<T, E>;
+#endif
+
+	static_assert(sizeof(nl::expected<int, std::errc>) == sizeof(reference_layout<int, std::errc>), "");
+	static_assert(sizeof(nl::expected<int, nl::status_code>) == sizeof(reference_layout<int, nl::status_code>), "");
+	static_assert(sizeof(nl::expected<char, bool>) == sizeof(reference_layout<char, bool>), "");
+	static_assert(sizeof(nl::expected<double, std::errc>) == sizeof(reference_layout<double, std::errc>), "");
+
+#if defined(captures_location)
+	static_assert(sizeof(nl::expected<int, nl::status_code>) == 32, "");
+#else
+	static_assert(sizeof(nl::expected<int, nl::status_code>) == 24, "");
+	static_assert(sizeof(nl::expected<int, std::errc>) == 8, "");
+#endif
+
+	nl::expected<int, std::errc> fail()
+	{
+		error_line = __LINE__ + 1;
+		return std::errc::invalid_argument;
+	}
+}
+
+int main()
+{
+	nl::expected<int, std::errc> result = fail();
+	assert(not result.has_value());
+
+	// the two layouts must never share a mangled name, or mixing modes links silently
+	const char* mangled = typeid(nl::expected<int, std::errc>).name();
+#if defined(captures_location)
+	static_assert(std::is_same<nl::expected<int, std::errc>, nl::located::expected<int, std::errc>>::value, "");
+	assert(std::strstr(mangled, "located") != nullptr);
+#else
+	assert(std::strstr(mangled, "located") == nullptr);
+#endif
+
+#if defined(captures_location)
+	nl::expected<int, std::errc> copy = result;
+	assert(copy.error_location().line() == error_line);
+	assert(std::strstr(copy.error_location().function_name(), "fail") != nullptr);
+
+	nl::expected<int, std::string> message = nl::unexpected("failed");
+	assert(message.error_location().line() == __LINE__ - 1);
+#endif
+
+	return 0;
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include tests/status_code.cpp && ./a.out
+ */
+
+#include <expected/status_code.hpp>
+#include <cassert>
+#include <cerrno>
+#include <string>
+#include <system_error>
+
+namespace {
+	const std::errc	       disk_equivalents[] = {std::errc::io_error, std::errc::no_space_on_device};
+	const char* const      disk_messages[]	  = {"disk failure", nullptr};
+	const nl::error_domain disk_domain	  = {"disk", disk_messages, 2, disk_equivalents, nullptr};
+	const nl::error_domain bare_domain	  = {"bare", nullptr, 2, disk_equivalents, nullptr};
+	const nl::error_domain other_disk_domain = {"disk", disk_messages, 2, disk_equivalents, nullptr};
+
+	class unknown_category_type : public std::error_category {
+		public:
+			const char* name() const noexcept override
+			{
+				return "unknown";
+			}
+
+			std::string message(int) const override
+			{
+				return "unknown";
+			}
+
+			std::error_condition default_error_condition(int code) const noexcept override
+			{
+				return std::error_condition(code, *this);
+			}
+	};
+
+	const std::error_category& unknown_category()
+	{
+		static const unknown_category_type category;
+		return category;
+	}
+}
+
+int main()
+{
+	nl::status_code failure(0, disk_domain);
+	nl::status_code full(1, disk_domain);
+	assert(failure.message() == "disk failure");
+	assert(full.message() == "disk error 1");
+	assert(full == std::errc::no_space_on_device);
+
+	nl::status_code bare(1, bare_domain);
+	assert(bare.message() == "bare error 1");
+	assert(bare == std::errc::no_space_on_device);
+
+	assert(failure == nl::status_code(0, disk_domain));
+	assert(failure != full);
+	assert(failure != nl::status_code(0, other_disk_domain));
+
+	nl::status_code posix = nl::from_errno(ENOENT);
+	assert(posix == std::errc::no_such_file_or_directory);
+	assert(std::errc::no_such_file_or_directory == posix && std::errc::timed_out != posix);
+	assert(posix == nl::from_error_code(std::make_error_code(std::errc::no_such_file_or_directory)));
+
+	// the built-in domains are usable in constant expressions
+	constexpr nl::status_code io(EIO, nl::generic_domain());
+	static_assert(io.domain() == &nl::generic_domain() && io.domain() != &nl::system_domain(), "");
+	static_assert(nl::unmapped_domain().category == nullptr, "");
+	assert(io == std::errc::io_error);
+
+	// a code whose category has no generic equivalent keeps its raw value
+	nl::status_code lost = nl::from_error_code(std::error_code(42, unknown_category()));
+	assert(lost.domain() == &nl::unmapped_domain() && lost.code() == 42);
+	assert(lost.message() == "unmapped error 42");
+
+	return 0;
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O1 -g -fsanitize=thread -I include tests/thread_pool.cpp && ./a.out
+ */
+
+#include <expected/thread_pool.hpp>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+	// the owner pushes and pops while several thieves steal; every task must be claimed exactly once
+	void stress_deque()
+	{
+		constexpr int				   tasks   = 20000;
+		constexpr int				   thieves = 6;
+		std::vector<nl::detail::pool_task>	   nodes(tasks);
+		std::vector<std::atomic<int>>		   claimed(tasks);
+		nl::detail::work_stealing_deque		   deque;
+		std::atomic<bool>			   finished(false);
+		auto					   claim = [&](nl::detail::pool_task* task)
+		{
+			claimed[task - nodes.data()].fetch_add(1, std::memory_order_relaxed);
+		};
+
+		std::vector<std::thread> workers;
+		for (int i = 0; i < thieves; i++)
+		{
+			workers.emplace_back(
+			    [&]
+			    {
+				    while (not finished.load(std::memory_order_acquire))
+				    {
+					    if (nl::detail::pool_task* task = deque.steal())
+						    claim(task);
+					    else
+						    std::this_thread::yield();
+				    }
+			    });
+		}
+
+		for (int i = 0; i < tasks; i++)
+		{
+			deque.push(&nodes[i]);
+			if (i % 3 == 0)
+			{
+				if (nl::detail::pool_task* task = deque.pop())
+					claim(task);
+			}
+		}
+		while (nl::detail::pool_task* task = deque.pop())
+			claim(task);
+
+		finished.store(true, std::memory_order_release);
+		for (std::thread& worker : workers)
+			worker.join();
+		for (std::atomic<int>& count : claimed)
+			assert(count.load() == 1);
+	}
+
+	// more workers than cores, with every task forking children that the others steal
+	void stress_pool()
+	{
+		nl::thread_pool	 pool(8);
+		std::atomic<int> done(0);
+		std::vector<nl::expected_future<int, std::string>> roots;
+		for (int i = 0; i < 64; i++)
+		{
+			roots.push_back(pool.submit(
+			    [&done, i]
+			    {
+				    for (int j = 0; j < 64; j++)
+					    nl::thread_pool::current()->post([&done] { done.fetch_add(1, std::memory_order_release); });
+				    return nl::expected<int, std::string>(i);
+			    }));
+		}
+		auto all = nl::when_all(std::move(roots));
+		assert(all.has_value() && all->size() == 64 && (*all)[63] == 63);
+		while (done.load(std::memory_order_acquire) != 64 * 64)
+			std::this_thread::yield();
+	}
+}
+
+int main()
+{
+	stress_deque();
+	stress_pool();
+
+	nl::thread_pool pool(4);
+
+	// a throwing posted task is dropped instead of unwinding the worker loop
+	for (int i = 0; i < 16; i++)
+		pool.post([] { throw std::runtime_error("posted"); });
+	assert(pool.submit([] { return nl::expected<int, std::string>(1); }).get().value() == 1);
+
+	// the parent pushes its children onto its own deque and then refuses to run them, so
+	// they can only finish by being stolen
+	constexpr int	 children = 2000;
+	std::atomic<int> done(0);
+	std::atomic<int> stolen(0);
+	auto		 parent = pool.submit(
+	     [&]
+	     {
+		     std::thread::id owner = std::this_thread::get_id();
+		     for (int i = 0; i < children; i++)
+			     nl::thread_pool::current()->post(
+				 [&, owner]
+				 {
+					 if (std::this_thread::get_id() != owner)
+						 stolen.fetch_add(1, std::memory_order_relaxed);
+					 done.fetch_add(1, std::memory_order_release);
+				 });
+		     while (stolen.load(std::memory_order_relaxed) == 0)
+			     std::this_thread::yield();
+		     return nl::expected<int, std::string>(0);
+	     });
+	assert(parent.get().has_value());
+	while (done.load(std::memory_order_acquire) != children)
+		std::this_thread::yield();
+	assert(stolen.load() > 0);
+
+	// when_all reports the error of the earliest future, not of the first one to fail
+	std::vector<nl::expected_future<int, std::string>> futures;
+	for (int i = 0; i < 8; i++)
+	{
+		futures.push_back(pool.submit(
+		    [i]
+		    {
+			    if (i == 2 || i == 5)
+				    return nl::expected<int, std::string>(nl::unexpected(std::string("failed ") + std::to_string(i)));
+			    return nl::expected<int, std::string>(i * i);
+		    }));
+	}
+	auto all = nl::when_all(std::move(futures));
+	assert(not all.has_value());
+	assert(all.error() == "failed 2");
+
+	futures.clear();
+	for (int i = 0; i < 8; i++)
+		futures.push_back(pool.submit([i] { return nl::expected<int, std::string>(i); }));
+	auto values = nl::when_all(std::move(futures));
+	assert(values.has_value() && values->size() == 8 && (*values)[7] == 7);
+
+	// three tasks hold their workers until when_any has returned, so only the fourth can win
+	std::atomic<bool> release(false);
+	auto		  blocked = [&]
+	{
+		while (not release.load(std::memory_order_acquire))
+			std::this_thread::yield();
+		return nl::expected<int, std::string>(-1);
+	};
+	futures.clear();
+	futures.push_back(pool.submit(blocked));
+	futures.push_back(pool.submit(blocked));
+	futures.push_back(pool.submit([] { return nl::expected<int, std::string>(42); }));
+	futures.push_back(pool.submit(blocked));
+	auto first = nl::when_any(futures);
+	assert(first.first == 2);
+	assert(first.second.value() == 42);
+	assert(not futures[2].valid());
+
+	release.store(true, std::memory_order_release);
+	for (std::size_t i = 0; i < futures.size(); i++)
+	{
+		if (futures[i].valid())
+			assert(futures[i].get().value() == -1);
+	}
+
+	// empty and moved-from futures are never ready
+	nl::expected_future<int, std::string> empty;
+	assert(not empty.ready());
+	auto				      source = pool.submit([] { return nl::expected<int, std::string>(5); });
+	auto				      target = std::move(source);
+	assert(not source.ready());
+	assert(target.get().value() == 5);
+
+	// a caller outside the pool sleeps until a late result wakes it
+	futures.clear();
+	futures.emplace_back();
+	futures.push_back(pool.submit(
+	    []
+	    {
+		    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		    return nl::expected<int, std::string>(nl::unexpected(std::string("late")));
+	    }));
+	auto late = nl::when_any(futures);
+	assert(late.first == 1 && late.second.error() == "late");
+
+	return 0;
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * frame pointers and an exported symbol table are needed for the frames to resolve:
+ * g++ -std=c++20 -O1 -fno-omit-frame-pointer -rdynamic -I include tests/traced.cpp && ./a.out
+ */
+
+#include <expected/traced.hpp>
+#include <cassert>
+#include <string>
+#include <system_error>
+#include <thread>
+
+using result = nl::expected<int, nl::traced<std::errc>>;
+
+__attribute__((noinline)) result innermost_frame(int depth)
+{
+	if (depth > 0)
+		return nl::traced<std::errc>(std::errc::io_error);
+	return 0;
+}
+
+__attribute__((noinline)) result middle_frame(int depth)
+{
+	result inner = innermost_frame(depth);
+	asm volatile("" ::: "memory");
+	return inner;
+}
+
+__attribute__((noinline)) result outer_frame(int depth)
+{
+	result middle = middle_frame(depth);
+	asm volatile("" ::: "memory");
+	return middle;
+}
+
+namespace {
+	void check_trace()
+	{
+		result failed = outer_frame(1);
+		assert(not failed.has_value());
+		assert(*failed.error() == std::errc::io_error);
+		assert(failed.error().message().rfind(std::make_error_code(std::errc::io_error).message(), 0) == 0);
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__linux__) && (defined(__x86_64__) || defined(__aarch64__))
+		assert(failed.error().depth() >= 3);
+		std::string trace = failed.error().backtrace();
+		std::size_t inner  = trace.find("innermost_frame");
+		std::size_t middle = trace.find("middle_frame");
+		std::size_t outer  = trace.find("outer_frame");
+		assert(inner != std::string::npos && middle != std::string::npos && outer != std::string::npos);
+		assert(inner < middle && middle < outer);
+#endif
+
+		// a copy carries the captured frames and the unused tail is zeroed rather than garbage
+		result copied = failed;
+		assert(copied.error().depth() == failed.error().depth());
+		for (std::size_t i = 0; i < 16; i++)
+			assert(copied.error().frame(i) == failed.error().frame(i));
+		for (std::size_t i = copied.error().depth(); i < 16; i++)
+			assert(copied.error().frame(i) == nullptr);
+
+		result succeeded = outer_frame(0);
+		assert(succeeded.has_value());
+	}
+}
+
+int main()
+{
+	check_trace();
+
+	std::thread worker(check_trace);
+	worker.join();
+
+	return 0;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++17 -O2 -I include tests/validated.cpp && ./a.out
+ */
+
+#include <expected/validated.hpp>
+#include <cassert>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using field = nl::expected<int, std::string>;
+
+struct point {
+		int x;
+		int y;
+};
+
+int main()
+{
+	static_assert(not std::is_copy_constructible<nl::validated<point, std::string>>::value, "");
+	static_assert(std::is_move_constructible<nl::validated<point, std::string>>::value, "");
+
+	unsigned char	   buffer[256];
+	nl::monotonic_arena arena(buffer, sizeof(buffer));
+
+	// all fields present: the callable runs once and its result is the value
+	auto ok = nl::validate(arena, [](int x, int y) { return point{x, y}; }, field(1), field(2));
+	assert(ok.has_value() && ok.value().y == 2 && ok.errors().empty());
+
+	// every failing field is kept, in argument order, instead of only the first
+	auto bad = nl::validate(arena, [](int x, int y, int z) { return x + y + z; }, field(nl::unexpected(std::string("x"))), field(2),
+	    field(nl::unexpected(std::string("z"))));
+	assert(not bad.has_value() && bad.errors().size() == 2);
+	std::vector<std::string> errors(bad.errors().begin(), bad.errors().end());
+	assert(errors == (std::vector<std::string>{"x", "z"}));
+
+	// moving transfers the list without copying its nodes
+	const std::string* first = &bad.errors().front();
+	auto		   moved = std::move(bad);
+	assert(&moved.errors().front() == first && bad.errors().empty());
+
+	// merging splices the other list and turns a valid result invalid
+	auto merged = nl::validate(arena, [](int x) { return x; }, field(3));
+	merged.merge(std::move(moved));
+	assert(not merged.has_value() && merged.errors().size() == 2);
+	merged.add_error("late");
+	assert(merged.errors().size() == 3);
+
+	// once the inline buffer is used up the arena keeps going on the heap, and the earlier
+	// nodes stay where they were
+	nl::error_list<std::string> many(arena);
+	for (int i = 0; i < 200; i++)
+		many.emplace_back(std::to_string(i));
+	assert(many.size() == 200);
+	int expected_index = 0;
+	for (const std::string& error : many)
+	{
+		assert(error == std::to_string(expected_index));
+		expected_index++;
+	}
+	const unsigned char* in_buffer = reinterpret_cast<const unsigned char*>(first);
+	assert(in_buffer >= buffer && in_buffer < buffer + sizeof(buffer));
+
+	// lists from different arenas cannot be spliced
+	nl::monotonic_arena other;
+	nl::error_list<std::string> foreign(other);
+	foreign.emplace_back("elsewhere");
+	bool caught = false;
+	try
+	{
+		many.splice(std::move(foreign));
+	}
+	catch (const std::runtime_error&)
+	{
+		caught = true;
+	}
+	assert(caught && foreign.size() == 1);
+
+	// an invalid state cannot be built from nothing
+	caught = false;
+	try
+	{
+		nl::validated<int, std::string> empty{nl::error_list<std::string>(arena)};
+	}
+	catch (const std::runtime_error&)
+	{
+		caught = true;
+	}
+	assert(caught);
+
+	return 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include tests/value_or.cpp && ./a.out
+ */
+
+#include <expected.hpp>
+#include <cassert>
+#include <system_error>
+#include <vector>
+
+struct pair {
+		long first;
+		long second;
+};
+
+int main()
+{
+	nl::expected<int, std::errc> value = 7;
+	nl::expected<int, std::errc> error = std::errc::invalid_argument;
+	assert(value.value_or(-1) == 7);
+	assert(error.value_or(-1) == -1);
+
+	nl::expected<double, int> real = 1.5;
+	nl::expected<double, int> failed = 3;
+	assert(real.value_or(2.5) == 1.5);
+	assert(failed.value_or(2.5) == 2.5);
+
+	nl::expected<pair, int> full = pair{1, 2};
+	nl::expected<pair, int> empty = 4;
+	assert(full.value_or(pair{3, 4}).second == 2);
+	assert(empty.value_or(pair{3, 4}).first == 3);
+
+	// an error narrower than the value leaves part of the storage uninitialized, so the
+	// selection must not blend through it
+	static_assert(nl::detail::is_branchless_selectable<int, std::errc>::value, "");
+	static_assert(not nl::detail::is_branchless_selectable<pair, char>::value, "");
+	static_assert(not nl::detail::is_branchless_selectable<double, int>::value, "");
+	nl::expected<pair, char> wide  = pair{5, 6};
+	nl::expected<pair, char> small = 'e';
+	assert(wide.value_or(pair{7, 8}).first == 5);
+	assert(small.value_or(pair{7, 8}).second == 8);
+
+	std::vector<nl::expected<pair, char>> mixed;
+	for (long i = 0; i < 100; i++)
+	{
+		if (i % 2 == 0)
+			mixed.emplace_back('e');
+		else
+			mixed.emplace_back(pair{i, -i});
+	}
+	std::vector<pair> selected(mixed.size());
+	nl::values_or(mixed.data(), mixed.size(), pair{-1, -1}, selected.data());
+	for (long i = 0; i < 100; i++)
+		assert(selected[i].second == (i % 2 == 0 ? -1 : -i));
+
+	nl::expected<std::string, int> text = std::string("text");
+	assert(text.value_or("fallback") == "text");
+
+	std::vector<nl::expected<int, std::errc>> inputs;
+	for (int i = 0; i < 1000; i++)
+	{
+		if (i % 3 == 0)
+			inputs.emplace_back(std::errc::io_error);
+		else
+			inputs.emplace_back(i);
+	}
+
+	std::vector<int> outputs(inputs.size());
+	nl::values_or(inputs.data(), inputs.size(), -1, outputs.data());
+	for (int i = 0; i < 1000; i++)
+		assert(outputs[i] == (i % 3 == 0 ? -1 : i));
+
+	return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright: 2025 nodeluna
+ * SPDX-License-Identifier: Apache-2.0
+ * repository: https://github.com/nodeluna/expected
+ *
+ * g++ -std=c++20 -O2 -I include tests/views.cpp && ./a.out
+ */
+
+#include <expected/views.hpp>
+#include <cassert>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <vector>
+
+using result = nl::expected<int, std::string>;
+
+int main()
+{
+	std::vector<result> results;
+	for (int i = 0; i < 10; i++)
+	{
+		if (i % 4 == 3)
+			results.emplace_back(nl::unexpected(std::string("bad ") + std::to_string(i)));
+		else
+			results.emplace_back(i);
+	}
+
+	auto values = results | nl::views::values;
+	static_assert(std::ranges::view<decltype(values)>);
+	static_assert(std::ranges::forward_range<decltype(values)>);
+	std::vector<int> seen;
+	for (int value : values)
+		seen.push_back(value);
+	assert(seen == (std::vector<int>{0, 1, 2, 4, 5, 6, 8, 9}));
+
+	std::vector<std::string> errors;
+	for (const std::string& error : results | nl::views::errors)
+		errors.push_back(error);
+	assert(errors == (std::vector<std::string>{"bad 3", "bad 7"}));
+
+	// an lvalue range is projected by reference, so the view writes through to the results
+	for (int& value : results | nl::views::values)
+		value *= 10;
+	assert(*results[1] == 10 && results[3].error() == "bad 3");
+	for (std::string& error : results | nl::views::errors)
+		error += "!";
+	assert(results[7].error() == "bad 7!");
+
+	// the view is a regular forward range: iterators compare, copies walk independently
+	auto first  = values.begin();
+	auto second = first;
+	++second;
+	assert(first != second && *first == 0 && *second == 10);
+
+	// an empty range and a range with no values produce nothing
+	std::vector<result> empty;
+	assert(std::ranges::distance(empty | nl::views::values) == 0);
+	std::vector<result> failures(3, result(nl::unexpected(std::string("x"))));
+	assert(std::ranges::distance(failures | nl::views::values) == 0);
+	assert(std::ranges::distance(failures | nl::views::errors) == 3);
+
+	std::vector<int> prefix;
+	for (const result& r : results | nl::views::take_while_ok)
+		prefix.push_back(*r);
+	assert(prefix == (std::vector<int>{0, 10, 20}));
+
+	// transform_ok maps values and carries errors through unchanged
+	std::vector<nl::expected<std::size_t, std::string>> mapped;
+	for (auto r : results | nl::views::transform_ok([](int value) { return std::to_string(value).size(); }))
+		mapped.push_back(r);
+	assert(mapped.size() == 10 && *mapped[0] == 1 && *mapped[2] == 2 && mapped[3].error() == "bad 3!");
+
+	// and_then flattens a fallible step into the same error channel
+	auto halve = [](int value) { return value % 20 == 0 ? result(value / 20) : result(nl::unexpected(std::string("odd"))); };
+	std::vector<result> halved;
+	for (auto r : nl::views::and_then(results, halve))
+		halved.push_back(r);
+	assert(*halved[0] == 0 && halved[1].error() == "odd" && *halved[2] == 1 && halved[3].error() == "bad 3!");
+
+	// begin() is cached, so only the first call walks past the leading errors
+	std::vector<result> late(100, result(nl::unexpected(std::string("early"))));
+	late.emplace_back(7);
+	int  inspected = 0;
+	auto counted   = late | std::views::transform([&](const result& r) -> const result& {
+		  inspected++;
+		  return r;
+	}) | nl::views::values;
+	assert(*counted.begin() == 7 && inspected == 102);
+	inspected = 0;
+	assert(*counted.begin() == 7 && inspected == 2);
+	auto copied = counted;
+	assert(*copied.begin() == 7 && std::ranges::distance(copied) == 1);
+
+	// move-only values are projected by reference, never copied
+	std::vector<nl::expected<std::unique_ptr<int>, int>> owned;
+	owned.emplace_back(std::make_unique<int>(5));
+	owned.emplace_back(nl::unexpected(1));
+	owned.emplace_back(std::make_unique<int>(6));
+	int total = 0;
+	for (auto& pointer : owned | nl::views::values)
+		total += *pointer;
+	assert(total == 11);
+
+	return 0;
+}